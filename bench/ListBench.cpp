@@ -0,0 +1,160 @@
+// This file benchmarks the core list
+// operations and reports wall clock
+// time and, with --perf on Linux,
+// hardware counters per element.
+//
+// Usage: ListBench [elements] [--perf]
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "CompactList.h"
+#include "LinkedList.h"
+#include "PerfCounters.h"
+
+using namespace linkedlist::singlelink;
+
+//Keeps results observable so the optimizer cannot drop the measured loops
+volatile long long benchSink = 0;
+
+template <typename Body>
+void measure(const std::string& name, long long elements, bool usePerf, Body body) {
+	bench::PerfCounters counters;
+
+	if (usePerf) {
+		counters.start();
+	}
+
+	auto startTime = std::chrono::steady_clock::now();
+	body();
+	auto endTime = std::chrono::steady_clock::now();
+
+	if (usePerf) {
+		counters.stop();
+	}
+
+	double nanoseconds = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+	std::cout << std::left << std::setw(14) << name
+		<< " elements=" << elements
+		<< " ns/elem=" << std::fixed << std::setprecision(3) << nanoseconds / (double)elements;
+
+	if (usePerf) {
+		if (counters.isAvailable()) {
+			for (int i = 0; i < counters.getCount(); i++) {
+				std::cout << ' ' << counters.getName(i) << "/elem=" << (double)counters.getValue(i) / (double)elements << (counters.isScaled(i) ? "(scaled)" : "");
+			}
+		} else {
+			std::cout << " (perf counters unavailable)";
+		}
+	}
+
+	std::cout << std::endl;
+}
+
+int main(int argc, char** argv) {
+	int elements = 1 << 20;
+	bool usePerf = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--perf") == 0) {
+			usePerf = true;
+		} else {
+			elements = std::atoi(argv[i]);
+		}
+	}
+
+	//List(length, pad) constructor
+	List<int> padded(0, 0);
+
+	measure("construct", elements, usePerf, [&]() {
+		padded = List<int>(elements, 1);
+	});
+
+	//Append one element at a time
+	List<int> appended;
+
+	measure("append", elements, usePerf, [&]() {
+		for (int i = 0; i < elements; i++) {
+			appended.append(i);
+		}
+	});
+
+	//Linear traversal through nextNode
+	measure("traverse", elements, usePerf, [&]() {
+		long long sum = 0;
+
+		for (DataNode<int>* node = appended.getListHead(); node != nullptr; node = node->getNextNode()) {
+			sum += node->getValue();
+		}
+
+		benchSink = sum;
+	});
+
+	//2D grid: rows linked through bottomNode of their first column
+	int colSize = 1024;
+	int rowSize = elements / colSize > 0 ? elements / colSize : 1;
+	std::vector<List<int>> rows;
+
+	for (int row = 0; row < rowSize; row++) {
+		rows.emplace_back(colSize, row);
+
+		if (row > 0) {
+			rows[row - 1].getListHead()->setBottomNode(rows[row].getListHead());
+		}
+	}
+
+	DataNode<int>* gridHead = rows[0].getListHead();
+
+	measure("row-walk-2d", (long long)rowSize * colSize, usePerf, [&]() {
+		long long sum = 0;
+
+		for (DataNode<int>* rowNode = gridHead; rowNode != nullptr; rowNode = rowNode->getBottomNode()) {
+			for (DataNode<int>* node = rowNode; node != nullptr; node = node->getNextNode()) {
+				sum += node->getValue();
+			}
+		}
+
+		benchSink = sum;
+	});
+
+	//Same traversals over index-linked nodes
+	CompactList<int> compact(elements, 1);
+
+	measure("compact-trav", elements, usePerf, [&]() {
+		long long sum = 0;
+
+		for (int value : compact) {
+			sum += value;
+		}
+
+		benchSink = sum;
+	});
+
+	CompactList<int> compactGrid(rowSize, colSize, 1);
+
+	measure("compact-2d", (long long)rowSize * colSize, usePerf, [&]() {
+		long long sum = 0;
+
+		for (int row = 0; row < compactGrid.getRowCount(); row++) {
+			std::uint32_t nodeIndex = compactGrid.getRowHead(row);
+
+			for (int col = 0; col < compactGrid.getRowSize(row); col++) {
+				sum += compactGrid.getNode(nodeIndex).getValue();
+				nodeIndex = compactGrid.getNode(nodeIndex).getNextIndex();
+			}
+		}
+
+		benchSink = sum;
+	});
+
+	return 0;
+}
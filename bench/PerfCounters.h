@@ -0,0 +1,214 @@
+// This file defines a small wrapper
+// around Linux perf_event_open used
+// by the benchmarks to read hardware
+// counters around a measured region.
+//
+// The counters are opened as one group
+// so they run over the same cycles.
+// When the PMU still has to multiplex
+// them the values are scaled by the
+// time enabled over the time running
+// and flagged as estimates.
+//
+// On other platforms, or when the
+// kernel refuses access, the counters
+// report as unavailable and only wall
+// clock time is printed.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) && defined(LINKEDLIST_BENCH_PERF)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+	//PerfCounters class
+	class PerfCounters {
+
+		private:
+			struct Counter {
+				std::string name;
+				int fd;
+				bool grouped;
+			};
+
+			//Layout of a read with TOTAL_TIME_ENABLED | TOTAL_TIME_RUNNING
+			struct Reading {
+				std::uint64_t value;
+				std::uint64_t timeEnabled;
+				std::uint64_t timeRunning;
+			};
+
+			std::vector<Counter> counters;
+			std::vector<std::uint64_t> values;
+			std::vector<bool> scaled;
+			int leaderFd;
+
+			void open(const std::string& name, std::uint32_t type, std::uint64_t config);
+
+		public:
+			PerfCounters();
+			~PerfCounters();
+
+			bool isAvailable();
+			void start();
+			void stop();
+
+			int getCount();
+			std::string getName(int index);
+			std::uint64_t getValue(int index);
+			bool isScaled(int index);
+
+	};
+
+}
+
+/**********************************************************************************************************/
+//                                 Perf Counters                                                          //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+inline bench::PerfCounters::PerfCounters() {
+	leaderFd = -1;
+
+#if defined(__linux__) && defined(LINKEDLIST_BENCH_PERF)
+	const std::uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+	const std::uint64_t dtlbReadMiss = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+	open("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+	open("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+	open("l1d-misses", PERF_TYPE_HW_CACHE, l1dReadMiss);
+	open("llc-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+	open("dtlb-misses", PERF_TYPE_HW_CACHE, dtlbReadMiss);
+#endif
+
+	values.assign(counters.size(), 0);
+	scaled.assign(counters.size(), false);
+}
+
+inline bench::PerfCounters::~PerfCounters() {
+#if defined(__linux__) && defined(LINKEDLIST_BENCH_PERF)
+	for (Counter& counter : counters) {
+		close(counter.fd);
+	}
+#endif
+}
+
+//-------Methods-------//
+
+//The first counter opened leads the group and the rest follow it. A counter that cannot
+//join the group is opened on its own, and one the kernel or hardware does not support is skipped.
+inline void bench::PerfCounters::open(const std::string& name, std::uint32_t type, std::uint64_t config) {
+#if defined(__linux__) && defined(LINKEDLIST_BENCH_PERF)
+	perf_event_attr attr;
+	std::memset(&attr, 0, sizeof(attr));
+
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+	//Members stay enabled and count whenever the leader does
+	attr.disabled = leaderFd < 0 ? 1 : 0;
+	int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, leaderFd, 0);
+	bool grouped = true;
+
+	if (fd < 0 && leaderFd >= 0) {
+		attr.disabled = 1;
+		fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+		grouped = false;
+	}
+
+	if (fd >= 0) {
+		if (leaderFd < 0) {
+			leaderFd = fd;
+		}
+
+		counters.push_back(Counter{ name, fd, grouped });
+	}
+#else
+	(void)name;
+	(void)type;
+	(void)config;
+#endif
+}
+
+inline bool bench::PerfCounters::isAvailable() {
+	return !counters.empty();
+}
+
+inline void bench::PerfCounters::start() {
+#if defined(__linux__) && defined(LINKEDLIST_BENCH_PERF)
+	for (Counter& counter : counters) {
+		if (counter.fd == leaderFd) {
+			ioctl(counter.fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+			ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		} else if (!counter.grouped) {
+			ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+#endif
+}
+
+//A counter that only ran for part of the region is scaled up to the whole of it
+inline void bench::PerfCounters::stop() {
+#if defined(__linux__) && defined(LINKEDLIST_BENCH_PERF)
+	for (Counter& counter : counters) {
+		if (counter.fd == leaderFd) {
+			ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+		} else if (!counter.grouped) {
+			ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+		}
+	}
+
+	for (std::size_t i = 0; i < counters.size(); i++) {
+		Reading reading{ 0, 0, 0 };
+
+		if (read(counters[i].fd, &reading, sizeof(reading)) != sizeof(reading) || reading.timeRunning == 0) {
+			values[i] = 0;
+			scaled[i] = reading.timeEnabled > 0;
+			continue;
+		}
+
+		values[i] = reading.value;
+		scaled[i] = reading.timeRunning < reading.timeEnabled;
+
+		if (scaled[i]) {
+			values[i] = (std::uint64_t)((double)reading.value * (double)reading.timeEnabled / (double)reading.timeRunning);
+		}
+	}
+#endif
+}
+
+inline int bench::PerfCounters::getCount() {
+	return (int)counters.size();
+}
+
+inline std::string bench::PerfCounters::getName(int index) {
+	return counters[index].name;
+}
+
+inline std::uint64_t bench::PerfCounters::getValue(int index) {
+	return values[index];
+}
+
+//Whether the counter was multiplexed, so its value is an estimate
+inline bool bench::PerfCounters::isScaled(int index) {
+	return scaled[index];
+}
@@ -0,0 +1,666 @@
+// This file defines the chunked deque,
+// a double ended queue whose values
+// live in fixed size blocks linked to
+// their neighbours like DataNodes.
+//
+// A map of block pointers, kept with
+// free slots on both sides, gives O(1)
+// indexing and lets blocks be added at
+// either end without moving values.
+// Blocks emptied by pops are kept on a
+// spare list and reused by later
+// pushes, so a queue that stays about
+// the same length stops allocating.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+#include "LinkedList.h"
+
+namespace linkedlist {
+
+	//ChunkedDeque class, by default a block holds about 4 KiB of values
+	template <typename T, std::size_t BlockElements = (sizeof(T) < 256 ? 4096 / sizeof(T) : 16), typename StoragePolicy = policy::HeapStorage, typename ThreadPolicy = policy::SingleThreaded, typename CheckPolicy = policy::ExitOnOutOfRange>
+	class ChunkedDeque {
+
+		static_assert(BlockElements > 0, "a block must hold at least one value");
+
+		private:
+			//BlockElements value slots, constructed only while they hold a value
+			struct Block {
+				Block* prevBlock;
+				Block* nextBlock;
+				alignas(T) unsigned char slots[BlockElements * sizeof(T)];
+
+				Block();
+
+				T* slot(std::size_t index);
+			};
+
+			//Blocks in order from mapBegin, the front value sits at headOffset in the first one
+			std::vector<Block*> blockMap;
+			std::size_t mapBegin;
+			std::size_t blockCount;
+			std::size_t headOffset;
+			std::size_t size;
+
+			//Recycled blocks, chained through nextBlock
+			Block* spareBlocks;
+			std::size_t spareCount;
+			std::size_t spareLimit;
+
+			[[no_unique_address]] StoragePolicy storage;
+			[[no_unique_address]] ThreadPolicy threadPolicy;
+
+#ifdef LINKEDLIST_ENABLE_STATS
+			stats::ListStats listStats;
+#endif
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+			static memory::MemoryUsage reportUsage(void* list);
+#endif
+
+			T* slotAt(std::size_t position);
+			Block* acquireBlock();
+			void releaseBlock(Block* block);
+			void reserveMapSlot(bool atFront);
+			void addBlockFront();
+			void addBlockBack();
+			void dropBlockFront();
+			void dropBlockBack();
+			void dropAllBlocks();
+
+		public:
+			//ChunkedDeque iterator, follows the block links from front to back
+			class Iterator {
+
+				private:
+					Block* currentBlock;
+					std::size_t slotIndex;
+					std::size_t remaining;
+
+				public:
+					using value_type = T;
+					using reference = T&;
+					using pointer = T*;
+					using difference_type = std::ptrdiff_t;
+					using iterator_category = std::forward_iterator_tag;
+
+					Iterator(Block* block, std::size_t slot, std::size_t count);
+
+					T& operator*() const;
+					T* operator->() const;
+					Iterator& operator++();
+					bool operator==(const Iterator& other) const;
+					bool operator!=(const Iterator& other) const;
+
+			};
+
+			ChunkedDeque();
+			ChunkedDeque(const ChunkedDeque& other);
+			ChunkedDeque(ChunkedDeque&& other) noexcept;
+			~ChunkedDeque();
+
+			void push_front(const T& newValue);
+			void push_front(T&& newValue);
+			void push_back(const T& newValue);
+			void push_back(T&& newValue);
+			template <typename... Args>
+			T& emplace_front(Args&&... args);
+			template <typename... Args>
+			T& emplace_back(Args&&... args);
+			void pop_front();
+			void pop_back();
+			void clear();
+
+			void setSpareLimit(std::size_t blocks);
+			void shrink_to_fit();
+
+			T& front();
+			T& back();
+			int getSize();
+			std::size_t getBlockCount();
+			std::size_t getSpareBlocks();
+			memory::MemoryUsage memoryUsage();
+
+			Iterator begin();
+			Iterator end();
+
+#ifdef LINKEDLIST_ENABLE_STATS
+			stats::ListStats getStats();
+#endif
+
+			//Overloaded operators
+			T& operator[](LINKEDLIST_INDEX_TYPE index);
+			ChunkedDeque& operator=(const ChunkedDeque& other);
+			ChunkedDeque& operator=(ChunkedDeque&& other) noexcept;
+
+			friend std::ostream& operator<<(std::ostream& outStream, ChunkedDeque& deque) {
+				for (T& value : deque) {
+					outStream << value << ' ';
+				}
+
+				return outStream;
+			}
+
+	};
+
+}
+
+/**********************************************************************************************************/
+//                                 Chunked Deque Block                                                    //
+/**********************************************************************************************************/
+
+//Leaves the slots uninitialised
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Block::Block() {
+	prevBlock = nullptr;
+	nextBlock = nullptr;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Block::slot(std::size_t index) {
+	return std::launder(reinterpret_cast<T*>(slots) + index);
+}
+
+/**********************************************************************************************************/
+//                                 Chunked Deque Iterator                                                 //
+/**********************************************************************************************************/
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::Iterator(Block* block, std::size_t slot, std::size_t count) {
+	currentBlock = block;
+	slotIndex = slot;
+	remaining = count;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator*() const {
+	return *currentBlock->slot(slotIndex);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator->() const {
+	return currentBlock->slot(slotIndex);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator++() {
+	slotIndex += 1;
+	remaining -= 1;
+
+	if (slotIndex == BlockElements) {
+		currentBlock = currentBlock->nextBlock;
+		slotIndex = 0;
+	}
+
+	return *this;
+}
+
+//Iterators are compared by how many values they have left
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator==(const Iterator& other) const {
+	return remaining == other.remaining;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator!=(const Iterator& other) const {
+	return remaining != other.remaining;
+}
+
+/**********************************************************************************************************/
+//                                 Chunked Deque                                                          //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::ChunkedDeque() {
+	mapBegin = 0;
+	blockCount = 0;
+	headOffset = 0;
+	size = 0;
+	spareBlocks = nullptr;
+	spareCount = 0;
+	spareLimit = 8;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(ChunkedDeque).name(), &ChunkedDeque::reportUsage));
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::ChunkedDeque(const ChunkedDeque& other) : ChunkedDeque() {
+	spareLimit = other.spareLimit;
+
+	for (std::size_t i = 0; i < other.size; i++) {
+		std::size_t position = other.headOffset + i;
+
+		emplace_back(*other.blockMap[other.mapBegin + position / BlockElements]->slot(position % BlockElements));
+	}
+}
+
+//Takes over the blocks of other, leaving it empty
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::ChunkedDeque(ChunkedDeque&& other) noexcept : blockMap(std::move(other.blockMap)), storage(std::move(other.storage)) {
+	mapBegin = other.mapBegin;
+	blockCount = other.blockCount;
+	headOffset = other.headOffset;
+	size = other.size;
+	spareBlocks = other.spareBlocks;
+	spareCount = other.spareCount;
+	spareLimit = other.spareLimit;
+	LINKEDLIST_STATS(listStats = other.listStats);
+
+	other.blockMap.clear();
+	other.mapBegin = 0;
+	other.blockCount = 0;
+	other.headOffset = 0;
+	other.size = 0;
+	other.spareBlocks = nullptr;
+	other.spareCount = 0;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(ChunkedDeque).name(), &ChunkedDeque::reportUsage));
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::~ChunkedDeque() {
+	LINKEDLIST_REGISTRY(memory::unregisterList(this));
+
+	clear();
+	shrink_to_fit();
+}
+
+/*-------Methods-------*/
+
+//position counts from the first slot of the first block
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::slotAt(std::size_t position) {
+	return blockMap[mapBegin + position / BlockElements]->slot(position % BlockElements);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Block* linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::acquireBlock() {
+	if (spareBlocks == nullptr) {
+		LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(Block)));
+
+		return storage.template allocate<Block>();
+	}
+
+	Block* block = spareBlocks;
+
+	spareBlocks = block->nextBlock;
+	spareCount -= 1;
+
+	block->prevBlock = nullptr;
+	block->nextBlock = nullptr;
+
+	return block;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::releaseBlock(Block* block) {
+	if (spareCount < spareLimit) {
+		block->nextBlock = spareBlocks;
+		spareBlocks = block;
+		spareCount += 1;
+	} else {
+		storage.deallocate(block);
+		LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(Block)));
+	}
+}
+
+//Makes room for one more block at the requested end. The blocks are recentred in the
+//map while it is at most half full, otherwise the map doubles.
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::reserveMapSlot(bool atFront) {
+	if (atFront ? mapBegin > 0 : mapBegin + blockCount < blockMap.size()) {
+		return;
+	}
+
+	if (blockCount * 2 < blockMap.size()) {
+		std::size_t newBegin = (blockMap.size() - blockCount) / 2;
+		auto blocksBegin = blockMap.begin() + mapBegin;
+
+		if (newBegin < mapBegin) {
+			std::copy(blocksBegin, blocksBegin + blockCount, blockMap.begin() + newBegin);
+		} else {
+			std::copy_backward(blocksBegin, blocksBegin + blockCount, blockMap.begin() + newBegin + blockCount);
+		}
+
+		mapBegin = newBegin;
+	} else {
+		std::vector<Block*> newMap(blockMap.size() < 4 ? 8 : blockMap.size() * 2, nullptr);
+		std::size_t newBegin = (newMap.size() - blockCount) / 2;
+
+		std::copy(blockMap.begin() + mapBegin, blockMap.begin() + mapBegin + blockCount, newMap.begin() + newBegin);
+
+		blockMap.swap(newMap);
+		mapBegin = newBegin;
+	}
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::addBlockFront() {
+	reserveMapSlot(true);
+
+	Block* block = acquireBlock();
+
+	if (blockCount > 0) {
+		block->nextBlock = blockMap[mapBegin];
+		blockMap[mapBegin]->prevBlock = block;
+	}
+
+	mapBegin -= 1;
+	blockMap[mapBegin] = block;
+	blockCount += 1;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::addBlockBack() {
+	reserveMapSlot(false);
+
+	Block* block = acquireBlock();
+
+	if (blockCount > 0) {
+		block->prevBlock = blockMap[mapBegin + blockCount - 1];
+		blockMap[mapBegin + blockCount - 1]->nextBlock = block;
+	}
+
+	blockMap[mapBegin + blockCount] = block;
+	blockCount += 1;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::dropBlockFront() {
+	Block* block = blockMap[mapBegin];
+
+	mapBegin += 1;
+	blockCount -= 1;
+
+	if (blockCount > 0) {
+		blockMap[mapBegin]->prevBlock = nullptr;
+	}
+
+	releaseBlock(block);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::dropBlockBack() {
+	Block* block = blockMap[mapBegin + blockCount - 1];
+
+	blockCount -= 1;
+
+	if (blockCount > 0) {
+		blockMap[mapBegin + blockCount - 1]->nextBlock = nullptr;
+	}
+
+	releaseBlock(block);
+}
+
+//Called once the deque is empty, the next push starts from the middle of the map again
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::dropAllBlocks() {
+	while (blockCount > 0) {
+		dropBlockBack();
+	}
+
+	mapBegin = blockMap.size() / 2;
+	headOffset = 0;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::push_front(const T& newValue) {
+	emplace_front(newValue);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::push_front(T&& newValue) {
+	emplace_front(std::move(newValue));
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::push_back(const T& newValue) {
+	emplace_back(newValue);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::push_back(T&& newValue) {
+	emplace_back(std::move(newValue));
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename... Args>
+T& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::emplace_front(Args&&... args) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	if (headOffset == 0) {
+		addBlockFront();
+		headOffset = BlockElements;
+	}
+
+	T* slot = new (blockMap[mapBegin]->slot(headOffset - 1)) T(std::forward<Args>(args)...);
+
+	headOffset -= 1;
+	size += 1;
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+
+	return *slot;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename... Args>
+T& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::emplace_back(Args&&... args) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	std::size_t position = headOffset + size;
+
+	if (position == blockCount * BlockElements) {
+		addBlockBack();
+	}
+
+	T* slot = new (slotAt(position)) T(std::forward<Args>(args)...);
+
+	size += 1;
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+
+	return *slot;
+}
+
+//A block left without values goes back to the spare list
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::pop_front() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(size > 0 ? blockMap[mapBegin] : nullptr);
+
+	blockMap[mapBegin]->slot(headOffset)->~T();
+	headOffset += 1;
+	size -= 1;
+
+	if (size == 0) {
+		dropAllBlocks();
+	} else if (headOffset == BlockElements) {
+		dropBlockFront();
+		headOffset = 0;
+	}
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::pop_back() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(size > 0 ? blockMap[mapBegin] : nullptr);
+
+	slotAt(headOffset + size - 1)->~T();
+	size -= 1;
+
+	if (size == 0) {
+		dropAllBlocks();
+	} else if (headOffset + size <= (blockCount - 1) * BlockElements) {
+		dropBlockBack();
+	}
+}
+
+//Destroys every value, the blocks are kept as spares up to the spare limit
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	for (std::size_t i = 0; i < size; i++) {
+		slotAt(headOffset + i)->~T();
+	}
+
+	size = 0;
+	dropAllBlocks();
+}
+
+//How many emptied blocks are kept for reuse, extra spares are freed straight away
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::setSpareLimit(std::size_t blocks) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	spareLimit = blocks;
+
+	while (spareCount > spareLimit) {
+		Block* block = spareBlocks;
+
+		spareBlocks = block->nextBlock;
+		spareCount -= 1;
+
+		storage.deallocate(block);
+		LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(Block)));
+	}
+}
+
+//Frees the spare blocks
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::shrink_to_fit() {
+	std::size_t limit = spareLimit;
+
+	setSpareLimit(0);
+	spareLimit = limit;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::front() {
+	CheckPolicy::checkNode(size > 0 ? blockMap[mapBegin] : nullptr);
+
+	return *blockMap[mapBegin]->slot(headOffset);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::back() {
+	CheckPolicy::checkNode(size > 0 ? blockMap[mapBegin] : nullptr);
+
+	return *slotAt(headOffset + size - 1);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline int linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::getSize() {
+	return (int)size;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline std::size_t linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::getBlockCount() {
+	return blockCount;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline std::size_t linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::getSpareBlocks() {
+	return spareCount;
+}
+
+//Unused slots of live and spare blocks count as padding, the block map as index
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::memoryUsage() {
+	memory::MemoryUsage usage;
+	std::size_t blocks = blockCount + spareCount;
+
+	usage.elements = size;
+	usage.objectBytes = sizeof(ChunkedDeque);
+	usage.nodeHeaderBytes = blocks * 2 * sizeof(Block*);
+	usage.payloadBytes = size * sizeof(T);
+	usage.paddingBytes = blocks * sizeof(Block) - usage.nodeHeaderBytes - usage.payloadBytes;
+	usage.allocatorSlackBytes = storage.slackBytes(blocks, sizeof(Block));
+	usage.indexBytes = blockMap.capacity() * sizeof(Block*);
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::begin() {
+	return Iterator(size > 0 ? blockMap[mapBegin] : nullptr, headOffset, size);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::end() {
+	return Iterator(nullptr, 0, 0);
+}
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::reportUsage(void* list) {
+	return static_cast<ChunkedDeque*>(list)->memoryUsage();
+}
+#endif
+
+#ifdef LINKEDLIST_ENABLE_STATS
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::stats::ListStats linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::getStats() {
+	return listStats;
+}
+#endif
+
+//-------Operators-------//
+
+//O(1) through the block map
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+T& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::operator[](LINKEDLIST_INDEX_TYPE index) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	int position = index > 0 ? (int)index : 0;
+
+	LINKEDLIST_STATS(stats::recordIndex(listStats, 0));
+	LINKEDLIST_PROFILE(profiler::recordTraversal(index.location, 0));
+
+	CheckPolicy::checkNode((std::size_t)position < size ? blockMap[mapBegin] : nullptr);
+
+	return *slotAt(headOffset + position);
+}
+
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(const ChunkedDeque& other) {
+	if (this != &other) {
+		ChunkedDeque copy(other);
+
+		*this = std::move(copy);
+	}
+
+	return *this;
+}
+
+//Swaps contents with other, which then owns the blocks this deque held before
+template <typename T, std::size_t BlockElements, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::ChunkedDeque<T, BlockElements, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(ChunkedDeque&& other) noexcept {
+	if (this != &other) {
+		std::swap(blockMap, other.blockMap);
+		std::swap(mapBegin, other.mapBegin);
+		std::swap(blockCount, other.blockCount);
+		std::swap(headOffset, other.headOffset);
+		std::swap(size, other.size);
+		std::swap(spareBlocks, other.spareBlocks);
+		std::swap(spareCount, other.spareCount);
+		std::swap(spareLimit, other.spareLimit);
+		std::swap(storage, other.storage);
+		LINKEDLIST_STATS(std::swap(listStats, other.listStats));
+	}
+
+	return *this;
+}
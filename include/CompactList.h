@@ -0,0 +1,475 @@
+// This file defines a growable list
+// whose nodes live in one vector and
+// link to each other by 32 bit index
+// instead of by pointer.
+//
+// A CompactList<int> node is 8 bytes
+// against 24 for a DataNode<int> plus
+// its malloc header, and neighbouring
+// nodes share cache lines. Indices
+// survive the vector growing, so the
+// arena can be reallocated freely.
+//
+// In 2D mode a small row table of
+// head and tail indices takes the
+// place of the per-node bottomNode.
+// Rows are stored one after another
+// in a single row-major chain.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "ListMemory.h"
+#include "StaticList.h"
+
+namespace linkedlist {
+
+	namespace singlelink {
+
+		//CompactList class
+		template <typename T, typename Index = std::uint32_t>
+		class CompactList {
+
+			public:
+				typedef StaticNode<T, Index> Node;
+
+				static constexpr Index END = std::numeric_limits<Index>::max();
+
+				//CompactList iterator
+				class Iterator {
+
+					private:
+						const CompactList* list;
+						Index position;
+
+					public:
+						Iterator(const CompactList* iteratedList, Index nodeIndex);
+
+						T operator*() const;
+						Iterator& operator++();
+						bool operator!=(const Iterator& other) const;
+
+				};
+
+			private:
+				std::vector<Node> nodes;
+				int size;
+				Index headIndex;
+				Index tailIndex;
+				Index freeIndex;
+
+				bool multiDim = false;
+				std::vector<Index> rowHeads;
+				std::vector<Index> rowTails;
+				std::vector<int> rowSizes;
+
+				Index allocateSlot(T newValue);
+				void releaseSlot(Index nodeIndex);
+				Index walkFrom(Index startIndex, int hops) const;
+				void linkAfter(Index previousIndex, Index newIndex);
+
+			public:
+				CompactList();
+				CompactList(int length, T padValue);
+				CompactList(int rowSize, int colSize, T padValue);
+
+				void reserve(int nodeCount);
+				void append(T newValue);
+				void append2D(T newValue, int row = 0);
+				void insert(int index, T newValue);
+				void remove(int index);
+				T popFront();
+				void clear();
+
+				int getSize() const;
+				int getCapacity() const;
+				int getRowCount() const;
+				int getRowSize(int row = 0) const;
+				Index getHeadIndex() const;
+				Index getTailIndex() const;
+				Index getRowHead(int row) const;
+				const Node& getNode(Index nodeIndex) const;
+				bool getMultiDim() const;
+				memory::MemoryUsage memoryUsage() const;
+
+				Iterator begin() const;
+				Iterator end() const;
+
+				//Overloaded operators
+				Node& operator[](int index);
+				const Node& operator[](int index) const;
+				Node& operator()(int row, int col);
+
+				friend std::ostream& operator<<(std::ostream& outStream, const CompactList& list) {
+					for (T value : list) {
+						outStream << value << ' ';
+					}
+
+					return outStream;
+				}
+
+		};
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Compact List Iterator                                                  //
+/**********************************************************************************************************/
+
+template <typename T, typename Index>
+linkedlist::singlelink::CompactList<T, Index>::Iterator::Iterator(const CompactList* iteratedList, Index nodeIndex) {
+	list = iteratedList;
+	position = nodeIndex;
+}
+
+template <typename T, typename Index>
+inline T linkedlist::singlelink::CompactList<T, Index>::Iterator::operator*() const {
+	return list->nodes[position].getValue();
+}
+
+template <typename T, typename Index>
+inline typename linkedlist::singlelink::CompactList<T, Index>::Iterator& linkedlist::singlelink::CompactList<T, Index>::Iterator::operator++() {
+	position = list->nodes[position].getNextIndex();
+
+	return *this;
+}
+
+template <typename T, typename Index>
+inline bool linkedlist::singlelink::CompactList<T, Index>::Iterator::operator!=(const Iterator& other) const {
+	return position != other.position;
+}
+
+/**********************************************************************************************************/
+//                                 Compact List                                                           //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T, typename Index>
+linkedlist::singlelink::CompactList<T, Index>::CompactList() {
+	size = 0;
+	headIndex = END;
+	tailIndex = END;
+	freeIndex = END;
+}
+
+template <typename T, typename Index>
+linkedlist::singlelink::CompactList<T, Index>::CompactList(int length, T padValue) : CompactList() {
+	reserve(length);
+
+	for (int i = 0; i < length; i++) {
+		append(padValue);
+	}
+}
+
+//rowSize rows of colSize elements each
+template <typename T, typename Index>
+linkedlist::singlelink::CompactList<T, Index>::CompactList(int rowSize, int colSize, T padValue) : CompactList() {
+	multiDim = true;
+	reserve(rowSize * colSize);
+
+	for (int row = 0; row < rowSize; row++) {
+		for (int col = 0; col < colSize; col++) {
+			append2D(padValue, row);
+		}
+	}
+}
+
+//-------Methods-------//
+
+//Reuses a released slot first, then grows the arena
+template <typename T, typename Index>
+Index linkedlist::singlelink::CompactList<T, Index>::allocateSlot(T newValue) {
+	Index newIndex = freeIndex;
+
+	if (freeIndex != END) {
+		freeIndex = nodes[freeIndex].getNextIndex();
+		nodes[newIndex] = Node(newValue, END);
+	} else if (nodes.size() < (std::size_t)END) {
+		newIndex = (Index)nodes.size();
+		nodes.emplace_back(newValue, END);
+	} else {
+		exit(139);
+	}
+
+	return newIndex;
+}
+
+template <typename T, typename Index>
+void linkedlist::singlelink::CompactList<T, Index>::releaseSlot(Index nodeIndex) {
+	nodes[nodeIndex] = Node(T(), freeIndex);
+	freeIndex = nodeIndex;
+}
+
+template <typename T, typename Index>
+Index linkedlist::singlelink::CompactList<T, Index>::walkFrom(Index startIndex, int hops) const {
+	Index currentIndex = startIndex;
+
+	for (int i = 0; i < hops; i++) {
+		currentIndex = nodes[currentIndex].getNextIndex();
+	}
+
+	return currentIndex;
+}
+
+//Links newIndex after previousIndex, or at the head when previousIndex is END
+template <typename T, typename Index>
+void linkedlist::singlelink::CompactList<T, Index>::linkAfter(Index previousIndex, Index newIndex) {
+	if (previousIndex == END) {
+		nodes[newIndex].setNextIndex(headIndex);
+		headIndex = newIndex;
+	} else {
+		nodes[newIndex].setNextIndex(nodes[previousIndex].getNextIndex());
+		nodes[previousIndex].setNextIndex(newIndex);
+	}
+
+	if (nodes[newIndex].getNextIndex() == END) {
+		tailIndex = newIndex;
+	}
+
+	size += 1;
+}
+
+template <typename T, typename Index>
+void linkedlist::singlelink::CompactList<T, Index>::reserve(int nodeCount) {
+	if (nodeCount > 0) {
+		nodes.reserve(nodeCount);
+	}
+}
+
+//In 2D mode appends to the last row
+template <typename T, typename Index>
+void linkedlist::singlelink::CompactList<T, Index>::append(T newValue) {
+	if (multiDim) {
+		append2D(newValue, rowHeads.empty() ? 0 : (int)rowHeads.size() - 1);
+		return;
+	}
+
+	linkAfter(tailIndex, allocateSlot(newValue));
+}
+
+//Appends to the end of row, adding empty rows up to it if needed. The new node
+//goes after the tail of row, or of the closest non-empty row before it.
+template <typename T, typename Index>
+void linkedlist::singlelink::CompactList<T, Index>::append2D(T newValue, int row) {
+	if (row < 0 || (!multiDim && size > 0)) {
+		exit(139);
+	}
+
+	multiDim = true;
+
+	if (row >= (int)rowHeads.size()) {
+		rowHeads.resize(row + 1, END);
+		rowTails.resize(row + 1, END);
+		rowSizes.resize(row + 1, 0);
+	}
+
+	Index previousIndex = END;
+
+	for (int r = row; r >= 0 && previousIndex == END; r--) {
+		previousIndex = rowTails[r];
+	}
+
+	Index newIndex = allocateSlot(newValue);
+
+	linkAfter(previousIndex, newIndex);
+
+	if (rowHeads[row] == END) {
+		rowHeads[row] = newIndex;
+	}
+
+	rowTails[row] = newIndex;
+	rowSizes[row] += 1;
+}
+
+//Inserts before the element at index; index == getSize() appends. 1D mode only.
+template <typename T, typename Index>
+void linkedlist::singlelink::CompactList<T, Index>::insert(int index, T newValue) {
+	if (multiDim || index < 0 || index > size) {
+		exit(139);
+	}
+
+	Index previousIndex = index == 0 ? END : walkFrom(headIndex, index - 1);
+
+	linkAfter(previousIndex, allocateSlot(newValue));
+}
+
+//1D mode only
+template <typename T, typename Index>
+void linkedlist::singlelink::CompactList<T, Index>::remove(int index) {
+	if (multiDim || index < 0 || index >= size) {
+		exit(139);
+	}
+
+	Index removedIndex = headIndex;
+
+	if (index == 0) {
+		headIndex = nodes[headIndex].getNextIndex();
+
+		if (headIndex == END) {
+			tailIndex = END;
+		}
+	} else {
+		Index previousIndex = walkFrom(headIndex, index - 1);
+
+		removedIndex = nodes[previousIndex].getNextIndex();
+		nodes[previousIndex].setNextIndex(nodes[removedIndex].getNextIndex());
+
+		if (removedIndex == tailIndex) {
+			tailIndex = previousIndex;
+		}
+	}
+
+	releaseSlot(removedIndex);
+	size -= 1;
+}
+
+template <typename T, typename Index>
+T linkedlist::singlelink::CompactList<T, Index>::popFront() {
+	if (size == 0) {
+		exit(139);
+	}
+
+	T frontValue = nodes[headIndex].getValue();
+
+	remove(0);
+
+	return frontValue;
+}
+
+//Drops every node and row at once, keeping the arena's capacity
+template <typename T, typename Index>
+void linkedlist::singlelink::CompactList<T, Index>::clear() {
+	nodes.clear();
+	rowHeads.clear();
+	rowTails.clear();
+	rowSizes.clear();
+
+	size = 0;
+	multiDim = false;
+	headIndex = END;
+	tailIndex = END;
+	freeIndex = END;
+}
+
+template <typename T, typename Index>
+inline int linkedlist::singlelink::CompactList<T, Index>::getSize() const {
+	return size;
+}
+
+template <typename T, typename Index>
+int linkedlist::singlelink::CompactList<T, Index>::getCapacity() const {
+	return (int)nodes.capacity();
+}
+
+template <typename T, typename Index>
+int linkedlist::singlelink::CompactList<T, Index>::getRowCount() const {
+	return multiDim ? (int)rowHeads.size() : 1;
+}
+
+template <typename T, typename Index>
+int linkedlist::singlelink::CompactList<T, Index>::getRowSize(int row) const {
+	if (!multiDim) {
+		return row == 0 ? size : 0;
+	}
+
+	return row >= 0 && row < (int)rowSizes.size() ? rowSizes[row] : 0;
+}
+
+template <typename T, typename Index>
+inline Index linkedlist::singlelink::CompactList<T, Index>::getHeadIndex() const {
+	return headIndex;
+}
+
+template <typename T, typename Index>
+inline Index linkedlist::singlelink::CompactList<T, Index>::getTailIndex() const {
+	return tailIndex;
+}
+
+template <typename T, typename Index>
+Index linkedlist::singlelink::CompactList<T, Index>::getRowHead(int row) const {
+	if (!multiDim) {
+		return row == 0 ? headIndex : END;
+	}
+
+	return row >= 0 && row < (int)rowHeads.size() ? rowHeads[row] : END;
+}
+
+template <typename T, typename Index>
+inline const typename linkedlist::singlelink::CompactList<T, Index>::Node& linkedlist::singlelink::CompactList<T, Index>::getNode(Index nodeIndex) const {
+	return nodes[nodeIndex];
+}
+
+template <typename T, typename Index>
+inline bool linkedlist::singlelink::CompactList<T, Index>::getMultiDim() const {
+	return multiDim;
+}
+
+//Released and reserved slots count as slack, the row table as index
+template <typename T, typename Index>
+linkedlist::memory::MemoryUsage linkedlist::singlelink::CompactList<T, Index>::memoryUsage() const {
+	memory::MemoryUsage usage;
+
+	usage.elements = size;
+	usage.objectBytes = sizeof(CompactList);
+	usage.nodeHeaderBytes = size * sizeof(Index);
+	usage.payloadBytes = size * sizeof(T);
+	usage.paddingBytes = size * (sizeof(Node) - sizeof(Index) - sizeof(T));
+	usage.allocatorSlackBytes = (nodes.capacity() - size) * sizeof(Node);
+	usage.indexBytes = rowHeads.capacity() * sizeof(Index) + rowTails.capacity() * sizeof(Index) + rowSizes.capacity() * sizeof(int);
+
+	if (nodes.capacity() > 0) {
+		usage.allocatorSlackBytes += memory::allocationSize(nodes.capacity() * sizeof(Node)) - nodes.capacity() * sizeof(Node);
+	}
+
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+template <typename T, typename Index>
+inline typename linkedlist::singlelink::CompactList<T, Index>::Iterator linkedlist::singlelink::CompactList<T, Index>::begin() const {
+	return Iterator(this, headIndex);
+}
+
+template <typename T, typename Index>
+inline typename linkedlist::singlelink::CompactList<T, Index>::Iterator linkedlist::singlelink::CompactList<T, Index>::end() const {
+	return Iterator(this, END);
+}
+
+//-------Operators-------//
+
+template <typename T, typename Index>
+typename linkedlist::singlelink::CompactList<T, Index>::Node& linkedlist::singlelink::CompactList<T, Index>::operator[](int index) {
+	return const_cast<Node&>(static_cast<const CompactList&>(*this)[index]);
+}
+
+//Indexes the row-major chain, so in 2D mode rows follow each other
+template <typename T, typename Index>
+const typename linkedlist::singlelink::CompactList<T, Index>::Node& linkedlist::singlelink::CompactList<T, Index>::operator[](int index) const {
+	if (index < 0 || index >= size) {
+		exit(139);
+	}
+
+	return nodes[walkFrom(headIndex, index)];
+}
+
+//Walks from the row head, so only col nodes are touched
+template <typename T, typename Index>
+typename linkedlist::singlelink::CompactList<T, Index>::Node& linkedlist::singlelink::CompactList<T, Index>::operator()(int row, int col) {
+	if (col < 0 || col >= getRowSize(row)) {
+		exit(139);
+	}
+
+	return nodes[walkFrom(getRowHead(row), col)];
+}
@@ -0,0 +1,619 @@
+// This file defines the doubly
+// linked list, whose nodes point
+// both to the next and previous
+// node.
+//
+// Both ends and any node reached
+// through an iterator can be
+// inserted or removed in O(1).
+// Storage, thread and check
+// policies are the same ones
+// used by singlelink::List.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <iostream>
+#include <new>
+#include <utility>
+#include "LinkedList.h"
+
+namespace linkedlist {
+
+	namespace doublelink {
+
+		//DataNode class
+		template <typename T>
+		class DataNode {
+
+		private:
+			DataNode<T>* prevNode;
+			DataNode<T>* nextNode;
+			T value;
+
+		public:
+			DataNode();
+			DataNode(T nodeValue);
+			template <typename... Args>
+			DataNode(std::in_place_t, Args&&... args);
+
+			void setValue(const T& nodeValue);
+			void setValue(T&& nodeValue);
+			void setPrevNode(DataNode<T>* nodePtrPrev);
+			void setNextNode(DataNode<T>* nodePtrNext);
+
+			T& getValue();
+			const T& getValue() const;
+			DataNode<T>* getPrevNode();
+			DataNode<T>* getNextNode();
+
+			//Overloaded operators
+			void operator=(const T& newValue);
+			void operator=(T&& newValue);
+			friend std::ostream& operator<<(std::ostream& outStream, DataNode<T>& node) {
+				outStream << node.getValue() << ' ';
+
+				return outStream;
+			}
+
+		};
+
+		//List class
+		template <typename T, typename StoragePolicy = policy::HeapStorage, typename ThreadPolicy = policy::SingleThreaded, typename CheckPolicy = policy::ExitOnOutOfRange>
+		class List {
+
+			private:
+				int size;
+
+				DataNode<T>* listHead;
+				DataNode<T>* listTail;
+
+				[[no_unique_address]] StoragePolicy storage;
+				[[no_unique_address]] ThreadPolicy threadPolicy;
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats listStats;
+#endif
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+				static memory::MemoryUsage reportUsage(void* list);
+#endif
+
+				void linkBefore(DataNode<T>* newNode, DataNode<T>* position);
+				void unlink(DataNode<T>* node);
+				void appendNodesOf(const List& source);
+
+			public:
+				typedef NodeIterator<DataNode<T>> Iterator;
+
+				List();
+				explicit List(const StoragePolicy& nodeStorage);
+				List(const List& other);
+				List(List&& other) noexcept;
+				~List();
+
+				void push_front(const T& newValue);
+				void push_front(T&& newValue);
+				void push_back(const T& newValue);
+				void push_back(T&& newValue);
+				template <typename... Args>
+				T& emplace_front(Args&&... args);
+				template <typename... Args>
+				T& emplace_back(Args&&... args);
+				template <typename... Args>
+				Iterator emplace(Iterator position, Args&&... args);
+				Iterator insert(Iterator position, const T& newValue);
+				void pop_front();
+				void pop_back();
+				Iterator erase(Iterator position);
+				void moveToFront(DataNode<T>* node);
+				void clear();
+
+				T& front();
+				T& back();
+				int getSize();
+				DataNode<T>* getListHead();
+				DataNode<T>* getListTail();
+				memory::MemoryUsage memoryUsage();
+
+				Iterator begin();
+				Iterator end();
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats getStats();
+#endif
+
+				//Overloaded operators
+				DataNode<T>& operator[](LINKEDLIST_INDEX_TYPE index);
+				List& operator=(const List& other);
+				List& operator=(List&& other) noexcept;
+
+				friend std::ostream& operator<<(std::ostream& outStream, List& list) {
+					for (DataNode<T>* currentNode = list.getListHead(); currentNode != nullptr; currentNode = currentNode->getNextNode()) {
+						outStream << currentNode->getValue() << ' ';
+					}
+
+					return outStream;
+				}
+
+		};
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Double Link Data Node                                                  //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T>
+linkedlist::doublelink::DataNode<T>::DataNode() : value() {
+	prevNode = nullptr;
+	nextNode = nullptr;
+}
+
+template <typename T>
+linkedlist::doublelink::DataNode<T>::DataNode(T nodeValue) : value(std::move(nodeValue)) {
+	prevNode = nullptr;
+	nextNode = nullptr;
+}
+
+//Constructs the value in place from args
+template <typename T>
+template <typename... Args>
+linkedlist::doublelink::DataNode<T>::DataNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...) {
+	prevNode = nullptr;
+	nextNode = nullptr;
+}
+
+//-------Methods-------//
+
+template <typename T>
+inline void linkedlist::doublelink::DataNode<T>::setValue(const T& nodeValue) {
+	value = nodeValue;
+}
+
+template <typename T>
+inline void linkedlist::doublelink::DataNode<T>::setValue(T&& nodeValue) {
+	value = std::move(nodeValue);
+}
+
+template <typename T>
+inline void linkedlist::doublelink::DataNode<T>::setPrevNode(DataNode<T>* nodePtrPrev) {
+	prevNode = nodePtrPrev;
+}
+
+template <typename T>
+inline void linkedlist::doublelink::DataNode<T>::setNextNode(DataNode<T>* nodePtrNext) {
+	nextNode = nodePtrNext;
+}
+
+template <typename T>
+inline T& linkedlist::doublelink::DataNode<T>::getValue() {
+	return value;
+}
+
+template <typename T>
+inline const T& linkedlist::doublelink::DataNode<T>::getValue() const {
+	return value;
+}
+
+template <typename T>
+inline linkedlist::doublelink::DataNode<T>* linkedlist::doublelink::DataNode<T>::getPrevNode() {
+	return prevNode;
+}
+
+template <typename T>
+inline linkedlist::doublelink::DataNode<T>* linkedlist::doublelink::DataNode<T>::getNextNode() {
+	return nextNode;
+}
+
+//-------Operators-------//
+
+template <typename T>
+inline void linkedlist::doublelink::DataNode<T>::operator=(const T& newValue) {
+	setValue(newValue);
+}
+
+template <typename T>
+inline void linkedlist::doublelink::DataNode<T>::operator=(T&& newValue) {
+	setValue(std::move(newValue));
+}
+
+/**********************************************************************************************************/
+//                                 Double Link List Controller                                            //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::List() {
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//Allocates nodes from nodeStorage, e.g. a pool shared with other lists
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::List(const StoragePolicy& nodeStorage) : storage(nodeStorage) {
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::List(const List& other) {
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	appendNodesOf(other);
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//Takes over the nodes of other, leaving it empty
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::List(List&& other) noexcept : storage(std::move(other.storage)) {
+	size = other.size;
+	listHead = other.listHead;
+	listTail = other.listTail;
+	LINKEDLIST_STATS(listStats = other.listStats);
+
+	other.size = 0;
+	other.listHead = nullptr;
+	other.listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::~List() {
+	LINKEDLIST_REGISTRY(memory::unregisterList(this));
+
+	clear();
+}
+
+/*-------Methods-------*/
+
+//Links newNode in front of position, or at the tail when position is null
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::linkBefore(DataNode<T>* newNode, DataNode<T>* position) {
+	DataNode<T>* prevNode = position == nullptr ? listTail : position->getPrevNode();
+
+	newNode->setPrevNode(prevNode);
+	newNode->setNextNode(position);
+
+	if (prevNode == nullptr) {
+		listHead = newNode;
+	} else {
+		prevNode->setNextNode(newNode);
+	}
+
+	if (position == nullptr) {
+		listTail = newNode;
+	} else {
+		position->setPrevNode(newNode);
+	}
+
+	size += 1;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::unlink(DataNode<T>* node) {
+	DataNode<T>* prevNode = node->getPrevNode();
+	DataNode<T>* nextNode = node->getNextNode();
+
+	if (prevNode == nullptr) {
+		listHead = nextNode;
+	} else {
+		prevNode->setNextNode(nextNode);
+	}
+
+	if (nextNode == nullptr) {
+		listTail = prevNode;
+	} else {
+		nextNode->setPrevNode(prevNode);
+	}
+
+	storage.deallocate(node);
+	LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+
+	size -= 1;
+}
+
+//With contiguous storage the copy is carved out of a single run, as in singlelink::List.
+//HeapStorage allocates node by node.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::appendNodesOf(const List& source) {
+	if (source.size == 0) {
+		return;
+	}
+
+	if constexpr (StoragePolicy::CONTIGUOUS_RUNS) {
+		policy::Guard<ThreadPolicy> guard(threadPolicy);
+		DataNode<T>* run = storage.template allocateRun<DataNode<T>>(source.size);
+		DataNode<T>* sourceNode = source.listHead;
+		LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>) * source.size, source.size));
+
+		for (int i = 0; i < source.size; i++) {
+			new (run + i) DataNode<T>(sourceNode->getValue());
+			linkBefore(run + i, nullptr);
+			sourceNode = sourceNode->getNextNode();
+		}
+	} else {
+		for (DataNode<T>* sourceNode = source.listHead; sourceNode != nullptr; sourceNode = sourceNode->getNextNode()) {
+			emplace_back(sourceNode->getValue());
+		}
+	}
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push_front(const T& newValue) {
+	emplace_front(newValue);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push_front(T&& newValue) {
+	emplace_front(std::move(newValue));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push_back(const T& newValue) {
+	emplace_back(newValue);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push_back(T&& newValue) {
+	emplace_back(std::move(newValue));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename... Args>
+inline T& linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::emplace_front(Args&&... args) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* valueNode = storage.template allocate<DataNode<T>>(std::in_place, std::forward<Args>(args)...);
+	LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+	linkBefore(valueNode, listHead);
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+
+	return valueNode->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename... Args>
+inline T& linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::emplace_back(Args&&... args) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* valueNode = storage.template allocate<DataNode<T>>(std::in_place, std::forward<Args>(args)...);
+	LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+	linkBefore(valueNode, nullptr);
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+
+	return valueNode->getValue();
+}
+
+//Constructs a value in front of position and returns an iterator to it
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename... Args>
+typename linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::emplace(Iterator position, Args&&... args) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* valueNode = storage.template allocate<DataNode<T>>(std::in_place, std::forward<Args>(args)...);
+	LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+	linkBefore(valueNode, position.getNode());
+
+	return Iterator(valueNode, &listTail);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::insert(Iterator position, const T& newValue) {
+	return emplace(position, newValue);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::pop_front() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(listHead);
+	unlink(listHead);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::pop_back() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(listTail);
+	unlink(listTail);
+}
+
+//Removes the node at position and returns an iterator to the one after it
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::erase(Iterator position) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* node = position.getNode();
+
+	CheckPolicy::checkNode(node);
+
+	DataNode<T>* nextNode = node->getNextNode();
+	unlink(node);
+
+	return Iterator(nextNode, &listTail);
+}
+
+//Relinks a node of this list at the head without touching its value
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::moveToFront(DataNode<T>* node) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(node);
+
+	if (node == listHead) {
+		return;
+	}
+
+	node->getPrevNode()->setNextNode(node->getNextNode());
+
+	if (node == listTail) {
+		listTail = node->getPrevNode();
+	} else {
+		node->getNextNode()->setPrevNode(node->getPrevNode());
+	}
+
+	node->setPrevNode(nullptr);
+	node->setNextNode(listHead);
+	listHead->setPrevNode(node);
+	listHead = node;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* currentNode = listHead;
+
+	while (currentNode != nullptr) {
+		DataNode<T>* nextNode = currentNode->getNextNode();
+
+		storage.deallocate(currentNode);
+		LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+
+		currentNode = nextNode;
+	}
+
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::front() {
+	CheckPolicy::checkNode(listHead);
+
+	return listHead->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::back() {
+	CheckPolicy::checkNode(listTail);
+
+	return listTail->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline int linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getSize() {
+	return size;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::doublelink::DataNode<T>* linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getListHead() {
+	return listHead;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::doublelink::DataNode<T>* linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getListTail() {
+	return listTail;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::memoryUsage() {
+	memory::MemoryUsage usage = memory::nodeUsage(size, sizeof(DataNode<T>), 2 * sizeof(DataNode<T>*), sizeof(T), sizeof(List));
+
+	usage.allocatorSlackBytes = storage.slackBytes(size, sizeof(DataNode<T>));
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::begin() {
+	return Iterator(listHead, &listTail);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::end() {
+	return Iterator(nullptr, &listTail);
+}
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::reportUsage(void* list) {
+	return static_cast<List*>(list)->memoryUsage();
+}
+#endif
+
+#ifdef LINKEDLIST_ENABLE_STATS
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::stats::ListStats linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getStats() {
+	return listStats;
+}
+#endif
+
+//-------Operators-------//
+
+//Walks from whichever end is closer to index
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::doublelink::DataNode<T>& linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator[](LINKEDLIST_INDEX_TYPE index) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	int position = index > 0 ? (int)index : 0;
+	DataNode<T>* currentNode;
+	int hops;
+
+	if (position < size - position) {
+		hops = position;
+		currentNode = listHead;
+		CheckPolicy::checkNode(currentNode);
+
+		for (int i = 0; i < hops; i++) {
+			currentNode = currentNode->getNextNode();
+			CheckPolicy::checkNode(currentNode);
+		}
+	} else {
+		hops = size - 1 - position;
+		currentNode = hops < 0 ? nullptr : listTail;
+		CheckPolicy::checkNode(currentNode);
+
+		for (int i = 0; i < hops; i++) {
+			currentNode = currentNode->getPrevNode();
+			CheckPolicy::checkNode(currentNode);
+		}
+	}
+
+	LINKEDLIST_STATS(stats::recordIndex(listStats, hops > 0 ? hops : 0));
+	LINKEDLIST_PROFILE(profiler::recordTraversal(index.location, hops > 0 ? hops : 0));
+
+	return *currentNode;
+}
+
+//Copies the elements of other into this list's own storage, as in singlelink::List
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(const List& other) {
+	if (this != &other) {
+		clear();
+		appendNodesOf(other);
+	}
+
+	return *this;
+}
+
+//Swaps contents with other, which then owns the nodes this list held before
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::doublelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(List&& other) noexcept {
+	if (this != &other) {
+		std::swap(size, other.size);
+		std::swap(listHead, other.listHead);
+		std::swap(listTail, other.listTail);
+		std::swap(storage, other.storage);
+		LINKEDLIST_STATS(std::swap(listStats, other.listStats));
+	}
+
+	return *this;
+}
@@ -0,0 +1,439 @@
+// This file defines a chained hash map
+// whose chains are singly linked
+// nodes hanging off one array of
+// bucket heads.
+//
+// Chain nodes come from the storage
+// policy, pooled by default, so an
+// insert costs no allocator call once
+// the pool has grown. When the map
+// doubles, buckets move to the new
+// array a few at a time on later
+// inserts and erases instead of all at
+// once, and lookups check whichever
+// array still holds the key's bucket.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include "LinkedList.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LINKEDLIST_PREFETCH(address) __builtin_prefetch(address)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define LINKEDLIST_PREFETCH(address) _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#define LINKEDLIST_PREFETCH(address)
+#endif
+
+namespace linkedlist {
+
+	//HashMap class
+	template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename StoragePolicy = policy::PooledStorage<>, typename ThreadPolicy = policy::SingleThreaded>
+	class HashMap {
+
+		public:
+			//One mapping. The full hash is kept to skip most key compares and to rehash without calling Hash.
+			struct Entry {
+				K key;
+				V value;
+				std::size_t hash;
+			};
+
+			//Chain node, a mapping and the link to the next node of its bucket
+			struct Node {
+				Node* nextNode;
+				Entry entry;
+
+				Node(Entry nodeEntry, Node* nodePtrNext);
+			};
+
+			//Old buckets moved per insert or erase while the map is growing
+			static constexpr std::size_t REHASH_STEP = 8;
+
+		private:
+			//While rehashing, slots j and j + oldCount are only set once old bucket j has moved,
+			//so a new array is never zeroed in one go
+			std::unique_ptr<Node*[]> buckets;
+			std::size_t bucketCount;
+
+			//Buckets of the previous array not yet moved over, from rehashIndex on.
+			//oldCount is 0 when no rehash is running.
+			std::unique_ptr<Node*[]> oldBuckets;
+			std::size_t oldCount;
+			std::size_t rehashIndex;
+
+			std::size_t size;
+
+			[[no_unique_address]] Hash hasher;
+			[[no_unique_address]] KeyEqual keyEqual;
+			[[no_unique_address]] StoragePolicy storage;
+			[[no_unique_address]] ThreadPolicy threadPolicy;
+
+			std::size_t hashOf(const K& key);
+			Node** bucketOf(std::size_t hash);
+			bool isInitialized(std::size_t slot);
+			Node* findNode(const K& key, std::size_t hash);
+			Node* insertNode(const K& key, std::size_t hash, V value);
+			void startRehash();
+			void rehashStep(std::size_t steps);
+
+		public:
+			HashMap(std::size_t initialBuckets = 16);
+			HashMap(const HashMap& other) = delete;
+			~HashMap();
+
+			V* find(const K& key);
+			bool contains(const K& key);
+			bool put(const K& key, V value);
+			bool erase(const K& key);
+			void prefetch(const K& key);
+			void clear();
+			template <typename Visitor>
+			void forEach(Visitor visitor);
+
+			int getSize();
+			std::size_t getBucketCount();
+			bool isRehashing();
+			memory::MemoryUsage memoryUsage();
+
+			//Overloaded operators
+			V& operator[](const K& key);
+			HashMap& operator=(const HashMap& other) = delete;
+
+	};
+
+}
+
+/**********************************************************************************************************/
+//                                 Hash Map Node                                                          //
+/**********************************************************************************************************/
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::Node::Node(Entry nodeEntry, Node* nodePtrNext) : nextNode(nodePtrNext), entry(std::move(nodeEntry)) {
+
+}
+
+/**********************************************************************************************************/
+//                                 Hash Map                                                               //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+//initialBuckets is rounded up to a power of two
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::HashMap(std::size_t initialBuckets) {
+	std::size_t slots = 16;
+
+	while (slots < initialBuckets) {
+		slots *= 2;
+	}
+
+	buckets = std::make_unique<Node*[]>(slots);
+	bucketCount = slots;
+	oldCount = 0;
+	rehashIndex = 0;
+	size = 0;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::~HashMap() {
+	clear();
+}
+
+//-------Methods-------//
+
+//Spreads the hash over the low bits, std::hash of an integer is often the integer itself
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline std::size_t linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::hashOf(const K& key) {
+	std::uint64_t mixed = (std::uint64_t)hasher(key);
+
+	mixed ^= mixed >> 33;
+	mixed *= 0xff51afd7ed558ccdULL;
+	mixed ^= mixed >> 33;
+
+	return (std::size_t)mixed;
+}
+
+//Head slot of the chain that holds hash, in the old array if its bucket has not moved yet
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline typename linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::Node** linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::bucketOf(std::size_t hash) {
+	if (oldCount != 0 && (hash & (oldCount - 1)) >= rehashIndex) {
+		return &oldBuckets[hash & (oldCount - 1)];
+	}
+
+	return &buckets[hash & (bucketCount - 1)];
+}
+
+//Slots of the new array are set once their old bucket has moved
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline bool linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::isInitialized(std::size_t slot) {
+	return oldCount == 0 || (slot & (oldCount - 1)) < rehashIndex;
+}
+
+//Walks the chain with the next node already on its way into the cache
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+typename linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::Node* linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::findNode(const K& key, std::size_t hash) {
+	Node* currentNode = *bucketOf(hash);
+
+	while (currentNode != nullptr) {
+		Node* nextNode = currentNode->nextNode;
+		Entry& entry = currentNode->entry;
+
+		LINKEDLIST_PREFETCH(nextNode);
+
+		if (entry.hash == hash && keyEqual(entry.key, key)) {
+			return currentNode;
+		}
+
+		currentNode = nextNode;
+	}
+
+	return nullptr;
+}
+
+//Doubles the bucket array. The chains stay in the old array until rehashStep moves them.
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::startRehash() {
+	//Growing again before the last rehash finished, move what is left first
+	if (oldCount != 0) {
+		rehashStep(oldCount);
+	}
+
+	oldBuckets = std::move(buckets);
+	oldCount = bucketCount;
+	rehashIndex = 0;
+
+	bucketCount *= 2;
+	buckets.reset(new Node*[bucketCount]);
+}
+
+//Moves up to steps non-empty old buckets, looking at no more than four times as many in all
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::rehashStep(std::size_t steps) {
+	std::size_t visits = steps * 4;
+
+	if (oldCount == 0) {
+		return;
+	}
+
+	while (rehashIndex < oldCount && steps > 0 && visits > 0) {
+		Node* currentNode = oldBuckets[rehashIndex];
+
+		if (currentNode != nullptr) {
+			steps -= 1;
+		}
+
+		buckets[rehashIndex] = nullptr;
+		buckets[rehashIndex + oldCount] = nullptr;
+
+		while (currentNode != nullptr) {
+			Node* nextNode = currentNode->nextNode;
+			Node*& head = buckets[currentNode->entry.hash & (bucketCount - 1)];
+
+			LINKEDLIST_PREFETCH(nextNode);
+
+			currentNode->nextNode = head;
+			head = currentNode;
+			currentNode = nextNode;
+		}
+
+		oldBuckets[rehashIndex] = nullptr;
+		rehashIndex += 1;
+		visits -= 1;
+	}
+
+	if (rehashIndex == oldCount) {
+		oldBuckets.reset();
+		oldCount = 0;
+		rehashIndex = 0;
+	}
+}
+
+//Links a new entry for key, which must be missing, at the head of its chain. The caller holds the guard.
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+typename linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::Node* linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::insertNode(const K& key, std::size_t hash, V value) {
+	Node** head = bucketOf(hash);
+
+	*head = storage.template allocate<Node>(Entry{ key, std::move(value), hash }, *head);
+	size += 1;
+
+	Node* node = *head;
+
+	if (size > bucketCount) {
+		startRehash();
+	}
+
+	return node;
+}
+
+//Returns the value mapped to key, or nullptr
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+V* linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::find(const K& key) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	Node* node = findNode(key, hashOf(key));
+
+	return node == nullptr ? nullptr : &node->entry.value;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline bool linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::contains(const K& key) {
+	return find(key) != nullptr;
+}
+
+//Maps key to value, replacing any previous value. Returns true when key is new.
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+bool linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::put(const K& key, V value) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	std::size_t hash = hashOf(key);
+	Node* node = findNode(key, hash);
+
+	rehashStep(REHASH_STEP);
+
+	if (node != nullptr) {
+		node->entry.value = std::move(value);
+		return false;
+	}
+
+	insertNode(key, hash, std::move(value));
+
+	return true;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+bool linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::erase(const K& key) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	std::size_t hash = hashOf(key);
+
+	rehashStep(REHASH_STEP);
+
+	Node** head = bucketOf(hash);
+	Node* previous = nullptr;
+
+	for (Node* currentNode = *head; currentNode != nullptr; currentNode = currentNode->nextNode) {
+		Entry& entry = currentNode->entry;
+
+		if (entry.hash == hash && keyEqual(entry.key, key)) {
+			if (previous == nullptr) {
+				*head = currentNode->nextNode;
+			} else {
+				previous->nextNode = currentNode->nextNode;
+			}
+
+			storage.deallocate(currentNode);
+			size -= 1;
+
+			return true;
+		}
+
+		previous = currentNode;
+	}
+
+	return false;
+}
+
+//Starts loading the chain head of key, for callers that know their next few keys ahead of time
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::prefetch(const K& key) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	Node* head = *bucketOf(hashOf(key));
+
+	LINKEDLIST_PREFETCH(head);
+}
+
+//Frees every node and finishes any rehash, the bucket array keeps its size
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	rehashStep(oldCount);
+
+	for (std::size_t slot = 0; slot < bucketCount; slot++) {
+		Node* currentNode = buckets[slot];
+
+		while (currentNode != nullptr) {
+			Node* nextNode = currentNode->nextNode;
+
+			storage.deallocate(currentNode);
+			currentNode = nextNode;
+		}
+
+		buckets[slot] = nullptr;
+	}
+
+	size = 0;
+}
+
+//Calls visitor(key, value) for every mapping, in no particular order
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+template <typename Visitor>
+void linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::forEach(Visitor visitor) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	for (std::size_t slot = 0; slot < bucketCount + oldCount; slot++) {
+		Node* head = nullptr;
+
+		if (slot < bucketCount && isInitialized(slot)) {
+			head = buckets[slot];
+		} else if (slot >= bucketCount && slot - bucketCount >= rehashIndex) {
+			head = oldBuckets[slot - bucketCount];
+		}
+
+		for (Node* currentNode = head; currentNode != nullptr; currentNode = currentNode->nextNode) {
+			visitor(currentNode->entry.key, currentNode->entry.value);
+		}
+	}
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline int linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::getSize() {
+	return (int)size;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline std::size_t linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::getBucketCount() {
+	return bucketCount;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline bool linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::isRehashing() {
+	return oldCount != 0;
+}
+
+//Chain nodes plus both bucket arrays while a rehash is running
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+linkedlist::memory::MemoryUsage linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::memoryUsage() {
+	memory::MemoryUsage usage = memory::nodeUsage(size, sizeof(Node), sizeof(Node*), sizeof(Entry), sizeof(HashMap));
+
+	usage.allocatorSlackBytes = storage.slackBytes(size, sizeof(Node));
+	usage.indexBytes = (bucketCount + oldCount) * sizeof(Node*);
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+//-------Operators-------//
+
+//Inserts a default constructed value when key is missing
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+V& linkedlist::HashMap<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::operator[](const K& key) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	std::size_t hash = hashOf(key);
+	Node* node = findNode(key, hash);
+
+	rehashStep(REHASH_STEP);
+
+	if (node == nullptr) {
+		node = insertNode(key, hash, V());
+	}
+
+	return node->entry.value;
+}
@@ -0,0 +1,619 @@
+// This file defines the intrusive
+// list, which threads its links
+// through a ListHook embedded in the
+// user's own objects instead of
+// allocating a node per element.
+//
+// The list never allocates or copies
+// values: it only links and unlinks
+// objects that live elsewhere, e.g.
+// in a pool. Insertion and unlinking
+// are O(1), and an object can sit in
+// as many lists as it has hooks.
+//
+// With the default ExitOnOutOfRange
+// check policy misuse such as linking
+// an object twice, unlinking one that
+// is in another list or destroying one
+// that is still linked exits with 139.
+// UncheckedIndex drops the checks.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include "LinkedList.h"
+
+namespace linkedlist {
+
+	namespace intrusive {
+
+		//ListHook class, embed one per list the object can belong to
+		class ListHook {
+
+			private:
+				ListHook* prevHook;
+				ListHook* nextHook;
+
+				//List the hook is linked into, only recorded by checked lists
+				const void* ownerList;
+
+			public:
+				ListHook();
+				ListHook(const ListHook& other);
+				~ListHook();
+
+				void setPrevHook(ListHook* hookPtrPrev);
+				void setNextHook(ListHook* hookPtrNext);
+				void setOwnerList(const void* listPtrOwner);
+
+				ListHook* getPrevHook();
+				ListHook* getNextHook();
+				const void* getOwnerList() const;
+				bool isLinked() const;
+
+				//Overloaded operators
+				ListHook& operator=(const ListHook& other);
+
+		};
+
+		//List class
+		template <typename T, ListHook T::* HookMember = &T::listHook, typename ThreadPolicy = policy::SingleThreaded, typename CheckPolicy = policy::ExitOnOutOfRange>
+		class List {
+
+			private:
+				int size;
+
+				//Sentinel closing the ring, it doubles as end()
+				ListHook rootHook;
+
+				[[no_unique_address]] ThreadPolicy threadPolicy;
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats listStats;
+#endif
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+				static memory::MemoryUsage reportUsage(void* list);
+#endif
+
+				//Byte offset of the hook inside T, -1 until an element has been handed to a list
+				static inline std::atomic<std::ptrdiff_t> measuredOffset = -1;
+
+				static std::ptrdiff_t hookOffset();
+				static T* ownerOf(ListHook* hook);
+				static ListHook* hookOf(T& element);
+
+				void linkBefore(ListHook* newHook, ListHook* position);
+				void unlink(ListHook* hook);
+				void adoptRing(List& other);
+				bool ownsHook(ListHook* hook);
+
+			public:
+				//Intrusive list iterator
+				class Iterator {
+
+					private:
+						ListHook* currentHook;
+
+					public:
+						using value_type = T;
+						using reference = T&;
+						using pointer = T*;
+						using difference_type = std::ptrdiff_t;
+						using iterator_category = std::bidirectional_iterator_tag;
+
+						Iterator();
+						Iterator(ListHook* hook);
+
+						ListHook* getHook() const;
+
+						//Overloaded operators
+						T& operator*() const;
+						T* operator->() const;
+						Iterator& operator++();
+						Iterator operator++(int);
+						Iterator& operator--();
+						Iterator operator--(int);
+						bool operator==(const Iterator& other) const;
+						bool operator!=(const Iterator& other) const;
+
+				};
+
+				List();
+				List(const List& other) = delete;
+				List(List&& other) noexcept;
+				~List();
+
+				void push_front(T& element);
+				void push_back(T& element);
+				Iterator insert(Iterator position, T& element);
+				void pop_front();
+				void pop_back();
+				Iterator erase(Iterator position);
+				void remove(T& element);
+				void clear();
+
+				T& front();
+				T& back();
+				int getSize();
+				T* getListHead();
+				T* getListTail();
+				memory::MemoryUsage memoryUsage();
+
+				Iterator begin();
+				Iterator end();
+				Iterator iteratorTo(T& element);
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats getStats();
+#endif
+
+				//Overloaded operators
+				T& operator[](LINKEDLIST_INDEX_TYPE index);
+				List& operator=(const List& other) = delete;
+				List& operator=(List&& other) noexcept;
+
+				friend std::ostream& operator<<(std::ostream& outStream, List& list) {
+					for (T& element : list) {
+						outStream << element << ' ';
+					}
+
+					return outStream;
+				}
+
+		};
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 List Hook                                                              //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+inline linkedlist::intrusive::ListHook::ListHook() {
+	prevHook = nullptr;
+	nextHook = nullptr;
+	ownerList = nullptr;
+}
+
+//Copying an object does not copy its membership
+inline linkedlist::intrusive::ListHook::ListHook(const ListHook&) {
+	prevHook = nullptr;
+	nextHook = nullptr;
+	ownerList = nullptr;
+}
+
+//An object destroyed while a checked list still links it would leave that list dangling
+inline linkedlist::intrusive::ListHook::~ListHook() {
+	if (ownerList != nullptr && isLinked()) {
+		exit(139);
+	}
+}
+
+//-------Methods-------//
+
+inline void linkedlist::intrusive::ListHook::setPrevHook(ListHook* hookPtrPrev) {
+	prevHook = hookPtrPrev;
+}
+
+inline void linkedlist::intrusive::ListHook::setNextHook(ListHook* hookPtrNext) {
+	nextHook = hookPtrNext;
+}
+
+inline void linkedlist::intrusive::ListHook::setOwnerList(const void* listPtrOwner) {
+	ownerList = listPtrOwner;
+}
+
+inline linkedlist::intrusive::ListHook* linkedlist::intrusive::ListHook::getPrevHook() {
+	return prevHook;
+}
+
+inline linkedlist::intrusive::ListHook* linkedlist::intrusive::ListHook::getNextHook() {
+	return nextHook;
+}
+
+inline const void* linkedlist::intrusive::ListHook::getOwnerList() const {
+	return ownerList;
+}
+
+inline bool linkedlist::intrusive::ListHook::isLinked() const {
+	return nextHook != nullptr;
+}
+
+//-------Operators-------//
+
+//Assigning an object keeps its own membership
+inline linkedlist::intrusive::ListHook& linkedlist::intrusive::ListHook::operator=(const ListHook&) {
+	return *this;
+}
+
+/**********************************************************************************************************/
+//                                 Intrusive List Iterator                                                //
+/**********************************************************************************************************/
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::Iterator() {
+	currentHook = nullptr;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::Iterator(ListHook* hook) {
+	currentHook = hook;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::intrusive::ListHook* linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::getHook() const {
+	return currentHook;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::operator*() const {
+	return *ownerOf(currentHook);
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::operator->() const {
+	return ownerOf(currentHook);
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator& linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::operator++() {
+	currentHook = currentHook->getNextHook();
+
+	return *this;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::operator++(int) {
+	Iterator previous = *this;
+
+	++(*this);
+
+	return previous;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator& linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::operator--() {
+	currentHook = currentHook->getPrevHook();
+
+	return *this;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::operator--(int) {
+	Iterator previous = *this;
+
+	--(*this);
+
+	return previous;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::operator==(const Iterator& other) const {
+	return currentHook == other.currentHook;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator::operator!=(const Iterator& other) const {
+	return currentHook != other.currentHook;
+}
+
+/**********************************************************************************************************/
+//                                 Intrusive List Controller                                              //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::List() {
+	size = 0;
+	rootHook.setPrevHook(&rootHook);
+	rootHook.setNextHook(&rootHook);
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//Takes over the elements of other, leaving it empty
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::List(List&& other) noexcept : List() {
+	adoptRing(other);
+	LINKEDLIST_STATS(listStats = other.listStats);
+}
+
+//Unlinks the remaining elements so their hooks can be reused
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::~List() {
+	LINKEDLIST_REGISTRY(memory::unregisterList(this));
+
+	clear();
+}
+
+/*-------Methods-------*/
+
+//Byte offset of the hook inside T, as hookOf measured it on a real element. A hook only
+//reaches ownerOf after its element went through hookOf, so the offset is known by then.
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline std::ptrdiff_t linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::hookOffset() {
+	return measuredOffset.load(std::memory_order_relaxed);
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::ownerOf(ListHook* hook) {
+	return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hookOffset());
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::intrusive::ListHook* linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::hookOf(T& element) {
+	ListHook* hook = &(element.*HookMember);
+
+	//Every element of T has the hook at the same offset, so racing stores write the same value
+	if (measuredOffset.load(std::memory_order_relaxed) < 0) {
+		measuredOffset.store(reinterpret_cast<char*>(hook) - reinterpret_cast<char*>(&element), std::memory_order_relaxed);
+	}
+
+	return hook;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::linkBefore(ListHook* newHook, ListHook* position) {
+	CheckPolicy::checkLink(!newHook->isLinked());
+
+	ListHook* prevHook = position->getPrevHook();
+
+	newHook->setPrevHook(prevHook);
+	newHook->setNextHook(position);
+	prevHook->setNextHook(newHook);
+	position->setPrevHook(newHook);
+
+	if constexpr (CheckPolicy::CHECKS_LINKS) {
+		newHook->setOwnerList(this);
+	}
+
+	size += 1;
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::unlink(ListHook* hook) {
+	CheckPolicy::checkLink(hook != &rootHook && ownsHook(hook));
+
+	hook->getPrevHook()->setNextHook(hook->getNextHook());
+	hook->getNextHook()->setPrevHook(hook->getPrevHook());
+	hook->setPrevHook(nullptr);
+	hook->setNextHook(nullptr);
+	hook->setOwnerList(nullptr);
+
+	size -= 1;
+}
+
+//Moves the ring of other onto this list's root, which must be empty
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::adoptRing(List& other) {
+	if (other.size == 0) {
+		return;
+	}
+
+	rootHook.setNextHook(other.rootHook.getNextHook());
+	rootHook.setPrevHook(other.rootHook.getPrevHook());
+	rootHook.getNextHook()->setPrevHook(&rootHook);
+	rootHook.getPrevHook()->setNextHook(&rootHook);
+	size = other.size;
+
+	other.rootHook.setPrevHook(&other.rootHook);
+	other.rootHook.setNextHook(&other.rootHook);
+	other.size = 0;
+
+	if constexpr (CheckPolicy::CHECKS_LINKS) {
+		for (ListHook* currentHook = rootHook.getNextHook(); currentHook != &rootHook; currentHook = currentHook->getNextHook()) {
+			currentHook->setOwnerList(this);
+		}
+	}
+}
+
+//Whether hook is linked into this list. Unchecked lists do not record owners and only see that it is linked.
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::ownsHook(ListHook* hook) {
+	if constexpr (CheckPolicy::CHECKS_LINKS) {
+		return hook->isLinked() && hook->getOwnerList() == this;
+	} else {
+		return hook->isLinked();
+	}
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::push_front(T& element) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	linkBefore(hookOf(element), rootHook.getNextHook());
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::push_back(T& element) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	linkBefore(hookOf(element), &rootHook);
+}
+
+//Links element in front of position and returns an iterator to it
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::insert(Iterator position, T& element) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkLink(position.getHook() != nullptr && (position.getHook() == &rootHook || ownsHook(position.getHook())));
+	linkBefore(hookOf(element), position.getHook());
+
+	return Iterator(hookOf(element));
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::pop_front() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	unlink(rootHook.getNextHook());
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::pop_back() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	unlink(rootHook.getPrevHook());
+}
+
+//Unlinks the element at position, which stays alive, and returns an iterator to the one after it
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::erase(Iterator position) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	ListHook* hook = position.getHook();
+
+	CheckPolicy::checkLink(hook != nullptr);
+
+	ListHook* nextHook = hook->getNextHook();
+	unlink(hook);
+
+	return Iterator(nextHook);
+}
+
+//O(1), element must be in this list
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::remove(T& element) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	unlink(hookOf(element));
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	ListHook* currentHook = rootHook.getNextHook();
+
+	while (currentHook != &rootHook) {
+		ListHook* nextHook = currentHook->getNextHook();
+
+		currentHook->setPrevHook(nullptr);
+		currentHook->setNextHook(nullptr);
+		currentHook->setOwnerList(nullptr);
+
+		currentHook = nextHook;
+	}
+
+	size = 0;
+	rootHook.setPrevHook(&rootHook);
+	rootHook.setNextHook(&rootHook);
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::front() {
+	CheckPolicy::checkLink(size > 0);
+
+	return *ownerOf(rootHook.getNextHook());
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::back() {
+	CheckPolicy::checkLink(size > 0);
+
+	return *ownerOf(rootHook.getPrevHook());
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline int linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::getSize() {
+	return size;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::getListHead() {
+	return size == 0 ? nullptr : ownerOf(rootHook.getNextHook());
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::getListTail() {
+	return size == 0 ? nullptr : ownerOf(rootHook.getPrevHook());
+}
+
+//The list owns no element memory, only the hooks count against it
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::memoryUsage() {
+	memory::MemoryUsage usage;
+
+	usage.elements = size;
+	usage.objectBytes = sizeof(List);
+	usage.nodeHeaderBytes = size * sizeof(ListHook);
+
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::begin() {
+	return Iterator(rootHook.getNextHook());
+}
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::end() {
+	return Iterator(&rootHook);
+}
+
+//O(1) iterator to an element already in the list
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::Iterator linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::iteratorTo(T& element) {
+	CheckPolicy::checkLink(ownsHook(hookOf(element)));
+
+	return Iterator(hookOf(element));
+}
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::reportUsage(void* list) {
+	return static_cast<List*>(list)->memoryUsage();
+}
+#endif
+
+#ifdef LINKEDLIST_ENABLE_STATS
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::stats::ListStats linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::getStats() {
+	return listStats;
+}
+#endif
+
+//-------Operators-------//
+
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+T& linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::operator[](LINKEDLIST_INDEX_TYPE index) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	int hops = index > 0 ? (int)index : 0;
+	ListHook* currentHook = rootHook.getNextHook();
+
+	LINKEDLIST_STATS(stats::recordIndex(listStats, hops));
+	LINKEDLIST_PROFILE(profiler::recordTraversal(index.location, hops));
+
+	CheckPolicy::checkNode(hops < size ? currentHook : nullptr);
+
+	for (int i = 0; i < hops; i++) {
+		currentHook = currentHook->getNextHook();
+	}
+
+	return *ownerOf(currentHook);
+}
+
+//Any elements this list held are unlinked first
+template <typename T, linkedlist::intrusive::ListHook T::* HookMember, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>& linkedlist::intrusive::List<T, HookMember, ThreadPolicy, CheckPolicy>::operator=(List&& other) noexcept {
+	if (this != &other) {
+		clear();
+		adoptRing(other);
+		LINKEDLIST_STATS(std::swap(listStats, other.listStats));
+	}
+
+	return *this;
+}
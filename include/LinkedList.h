@@ -7,7 +7,45 @@
 // Created on 06/07/2024
 
 #pragma once
+#include <cstring>
 #include <iostream>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "ListIterator.h"
+#include "ListMemory.h"
+#include "ListPolicies.h"
+
+#ifdef LINKEDLIST_ENABLE_STATS
+#include "ListStats.h"
+#define LINKEDLIST_STATS(statement) statement
+#else
+#define LINKEDLIST_STATS(statement)
+#endif
+
+#ifdef LINKEDLIST_ENABLE_PROFILER
+#include "ListProfiler.h"
+#define LINKEDLIST_PROFILE(statement) statement
+#define LINKEDLIST_INDEX_TYPE linkedlist::profiler::IndexSite
+#else
+#define LINKEDLIST_PROFILE(statement)
+#define LINKEDLIST_INDEX_TYPE int
+#endif
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+#include <typeinfo>
+#define LINKEDLIST_REGISTRY(statement) statement
+#else
+#define LINKEDLIST_REGISTRY(statement)
+#endif
+
+#ifdef LINKEDLIST_ENABLE_TRACE
+#include "ListTrace.h"
+#define LINKEDLIST_TRACE(statement) statement
+#else
+#define LINKEDLIST_TRACE(statement)
+#endif
 
 namespace linkedlist {
 
@@ -27,21 +65,26 @@ namespace linkedlist {
 			DataNode(T nodeValue);
 			DataNode(T nodeValue, DataNode<T>* nodePtrNext);
 			DataNode(T nodeValue, DataNode<T>* nodePtrNext, DataNode<T>* nodePtrBottom);
+			template <typename... Args>
+			DataNode(std::in_place_t, Args&&... args);
 
-			void setValue(T nodeValue);
+			void setValue(const T& nodeValue);
+			void setValue(T&& nodeValue);
 			void setNextNode(DataNode<T>* nodePtrNext);
 			void setBottomNode(DataNode<T>* nodePtrBottom);
 			void addNode(DataNode<T>* nodePtrNew);
 
-			T getValue();
+			T& getValue();
+			const T& getValue() const;
 			DataNode<T>* getNextNode();
 			DataNode<T>* getBottomNode();
 
 			//Overloaded operators
 			DataNode<T>& operator[](int index);
-			void operator=(T newValue);
+			void operator=(const T& newValue);
+			void operator=(T&& newValue);
 			friend std::ostream& operator<<(std::ostream& outStream, DataNode<T>& node) {
-				T nodeValue = node.getValue();
+				const T& nodeValue = node.getValue();
 
 				if (!nodeValue) {
 					outStream << ' ' << ' ';
@@ -55,7 +98,7 @@ namespace linkedlist {
 		};
 
 		//List class
-		template <typename T>
+		template <typename T, typename StoragePolicy = policy::HeapStorage, typename ThreadPolicy = policy::SingleThreaded, typename CheckPolicy = policy::ExitOnOutOfRange, typename SearchPolicy = policy::NoReordering>
 		class List {
 
 			private:
@@ -65,30 +108,82 @@ namespace linkedlist {
 				DataNode<T>* listHead;
 				DataNode<T>* listTail;
 
+				[[no_unique_address]] StoragePolicy storage;
+				[[no_unique_address]] ThreadPolicy threadPolicy;
+				[[no_unique_address]] SearchPolicy searchPolicy;
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats listStats;
+#endif
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+				static memory::MemoryUsage reportUsage(void* list);
+#endif
+
+				void appendCopies(int count, const T& padValue);
+				void linkNode(DataNode<T>* nodePtrNew);
+				void linkRun(DataNode<T>* run, int count);
+
+				template <typename SourceList>
+				void appendNodesOf(SourceList& source);
+
+				template <typename, typename, typename, typename, typename>
+				friend class List;
+
 			public:
+				typedef NodeIterator<DataNode<T>> Iterator;
+
 				List();
+				explicit List(const StoragePolicy& nodeStorage);
 				List(int length, T padValue);
 				List(int rowSize, int colSize, T padValue);
-				List(DataNode<T>* nodePtrHead);
-				List(DataNode<T>* nodePtrHead, DataNode<T>* nodePtrTail);
-
-				void setListHead(DataNode<T>* nodePtrHead);
-				void setListTail(DataNode<T>* nodePtrTail);
+				List(DataNode<T>* nodePtrHead) requires StoragePolicy::ADOPTS_NODES;
+				List(DataNode<T>* nodePtrHead, DataNode<T>* nodePtrTail) requires StoragePolicy::ADOPTS_NODES;
+				List(const List& other);
+				List(List&& other) noexcept;
+				~List();
+
+				void setListHead(DataNode<T>* nodePtrHead) requires StoragePolicy::ADOPTS_NODES;
+				void setListTail(DataNode<T>* nodePtrTail) requires StoragePolicy::ADOPTS_NODES;
 				void setMultiDim(bool isMultiDim);
-				void addElement(DataNode<T>* nodePtrNew);
-				void append(T newValue);
+				void addElement(DataNode<T>* nodePtrNew) requires StoragePolicy::ADOPTS_NODES;
+				void fill(const T& fillValue);
+				void clear();
+				void append(const T& newValue);
+				void append(T&& newValue);
+				template <typename... Args>
+				T& emplace_back(Args&&... args);
+				template <typename Producer>
+				bool appendFrom(int count, Producer nextValue);
 				void append2D(T newValue, int row = 0, bool keepDims = true, T padValue = T());
+				DataNode<T>* find(const T& searchValue);
+				bool contains(const T& searchValue);
 
 				int getSize();
 				int getRowSize(int row = 0);
 				bool getMultiDim();
 				DataNode<T>* getListHead();
 				DataNode<T>* getListTail();
+				memory::MemoryUsage memoryUsage();
+
+				Iterator begin();
+				Iterator end();
+
+				List clone();
+				template <typename TargetStorage>
+				List<T, TargetStorage, ThreadPolicy, CheckPolicy, SearchPolicy> clone(const TargetStorage& targetStorage);
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats getStats();
+#endif
 
 				//Overloaded operators
-				DataNode<T>& operator[](int index);
+				DataNode<T>& operator[](LINKEDLIST_INDEX_TYPE index);
+				List& operator=(const List& other);
+				List& operator=(List&& other) noexcept;
 
-				friend std::ostream& operator<<(std::ostream& outStream, List<T>& list) {
+				friend std::ostream& operator<<(std::ostream& outStream, List& list) {
+					LINKEDLIST_TRACE(trace::Span span("List::operator<<", list.getSize(), list.getSize()));
 					DataNode<T>* currentNode = list.getListHead();
 
 					if (list.getMultiDim()) {
@@ -117,52 +212,61 @@ namespace linkedlist {
 //-------Constructors-------//
 
 template <typename T>
-linkedlist::singlelink::DataNode<T>::DataNode() {
+linkedlist::singlelink::DataNode<T>::DataNode() : value() {
 	nextNode = nullptr;
 	bottomNode = nullptr;
-	value = NULL;
 }
 
 template <typename T>
-linkedlist::singlelink::DataNode<T>::DataNode(T nodeValue) {
+linkedlist::singlelink::DataNode<T>::DataNode(T nodeValue) : value(std::move(nodeValue)) {
 	nextNode = nullptr;
 	bottomNode = nullptr;
-	value = nodeValue;
 }
 
 template <typename T>
-linkedlist::singlelink::DataNode<T>::DataNode(T nodeValue, DataNode<T>* nodePtrNext) {
+linkedlist::singlelink::DataNode<T>::DataNode(T nodeValue, DataNode<T>* nodePtrNext) : value(std::move(nodeValue)) {
 	nextNode = nodePtrNext;
 	bottomNode = nullptr;
-	value = nodeValue;
 }
 
 template <typename T>
-linkedlist::singlelink::DataNode<T>::DataNode(T nodeValue, DataNode<T>* nodePtrNext, DataNode<T>* nodePtrBottom) {
+linkedlist::singlelink::DataNode<T>::DataNode(T nodeValue, DataNode<T>* nodePtrNext, DataNode<T>* nodePtrBottom) : value(std::move(nodeValue)) {
 	nextNode = nodePtrNext;
 	bottomNode = nodePtrBottom;
-	value = nodeValue;
+}
+
+//Constructs the value in place from args
+template <typename T>
+template <typename... Args>
+linkedlist::singlelink::DataNode<T>::DataNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...) {
+	nextNode = nullptr;
+	bottomNode = nullptr;
 }
 
 //-------Methods-------//
 
 template <typename T>
-void linkedlist::singlelink::DataNode<T>::setValue(T nodeValue) {
+inline void linkedlist::singlelink::DataNode<T>::setValue(const T& nodeValue) {
 	value = nodeValue;
 }
 
 template <typename T>
-void linkedlist::singlelink::DataNode<T>::setNextNode(DataNode<T>* nodePtrNext) {
+inline void linkedlist::singlelink::DataNode<T>::setValue(T&& nodeValue) {
+	value = std::move(nodeValue);
+}
+
+template <typename T>
+inline void linkedlist::singlelink::DataNode<T>::setNextNode(DataNode<T>* nodePtrNext) {
 	nextNode = nodePtrNext;
 }
 
 template <typename T>
-void linkedlist::singlelink::DataNode<T>::setBottomNode(DataNode<T>* nodePtrBottom) {
+inline void linkedlist::singlelink::DataNode<T>::setBottomNode(DataNode<T>* nodePtrBottom) {
 	bottomNode = nodePtrBottom;
 }
 
 template <typename T>
-void linkedlist::singlelink::DataNode<T>::addNode(DataNode<T>* nodePtrNew) {
+inline void linkedlist::singlelink::DataNode<T>::addNode(DataNode<T>* nodePtrNew) {
 	if (nextNode == nullptr) {
 		nextNode = nodePtrNew;
 	} else {
@@ -172,17 +276,22 @@ void linkedlist::singlelink::DataNode<T>::addNode(DataNode<T>* nodePtrNew) {
 }
 
 template <typename T>
-T linkedlist::singlelink::DataNode<T>::getValue() {
+inline T& linkedlist::singlelink::DataNode<T>::getValue() {
 	return value;
 }
 
 template <typename T>
-linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::DataNode<T>::getNextNode() {
+inline const T& linkedlist::singlelink::DataNode<T>::getValue() const {
+	return value;
+}
+
+template <typename T>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::DataNode<T>::getNextNode() {
 	return nextNode;
 }
 
 template <typename T>
-linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::DataNode<T>::getBottomNode() {
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::DataNode<T>::getBottomNode() {
 	return bottomNode;
 }
 
@@ -204,89 +313,328 @@ linkedlist::singlelink::DataNode<T>& linkedlist::singlelink::DataNode<T>::operat
 }
 
 template <typename T>
-void linkedlist::singlelink::DataNode<T>::operator=(T newValue) {
+inline void linkedlist::singlelink::DataNode<T>::operator=(const T& newValue) {
 	setValue(newValue);
 }
 
+template <typename T>
+inline void linkedlist::singlelink::DataNode<T>::operator=(T&& newValue) {
+	setValue(std::move(newValue));
+}
+
 /**********************************************************************************************************/
 //                                 Single Link List Controller                                            //
 /**********************************************************************************************************/
 
 //-------Constructors-------//
 
-template <typename T>
-linkedlist::singlelink::List<T>::List() {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::List() {
 	size = 0;
 	listHead = nullptr;
 	listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
 }
 
-template <typename T>
-linkedlist::singlelink::List<T>::List(int length, T padValue) {
+//Allocates nodes from nodeStorage, e.g. a pool shared with other lists
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::List(const StoragePolicy& nodeStorage) : storage(nodeStorage) {
 	size = 0;
 	listHead = nullptr;
 	listTail = nullptr;
 
-	for (int i = 0; i < length; i++) {
-		DataNode<T>* newNode = new DataNode<T>(padValue);
-		addElement(newNode);
-	}
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
 }
 
-template <typename T>
-linkedlist::singlelink::List<T>::List(int rowSize, int colSize, T padValue) {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::List(int length, T padValue) {
+	LINKEDLIST_TRACE(trace::Span span("List::List(length, pad)", length, length));
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	appendCopies(length, padValue);
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::List(int rowSize, int colSize, T padValue) {
 	size = 0;
 	multiDim = true;
 	listHead = nullptr;
 	listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
 }
 
-template <typename T>
-linkedlist::singlelink::List<T>::List(DataNode<T>* nodePtrHead) {
-	size = 1;
+//Adopts the chain starting at nodePtrHead. The list takes ownership of its nodes, which
+//must come from new, and frees them with its storage.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::List(DataNode<T>* nodePtrHead) requires StoragePolicy::ADOPTS_NODES {
+	size = 0;
 	listHead = nodePtrHead;
-	listTail = nodePtrHead;
-}
+	listTail = nullptr;
 
-template <typename T>
-linkedlist::singlelink::List<T>::List(DataNode<T>* nodePtrHead, DataNode<T>* nodePtrTail) {
-	if (nodePtrHead == nodePtrTail) {
-		size = 1;
-	} else {
-		size = 2;
+	for (DataNode<T>* currentNode = nodePtrHead; currentNode != nullptr; currentNode = currentNode->getNextNode()) {
+		listTail = currentNode;
+		size += 1;
 	}
 
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//Adopts the nodes from nodePtrHead up to and including nodePtrTail, which must be reachable
+//from it. The list takes ownership of them as above and cuts the link after nodePtrTail.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::List(DataNode<T>* nodePtrHead, DataNode<T>* nodePtrTail) requires StoragePolicy::ADOPTS_NODES {
+	DataNode<T>* currentNode = nodePtrHead;
+	size = 0;
 	listHead = nodePtrHead;
 	listTail = nodePtrTail;
+
+	while (currentNode != nullptr) {
+		size += 1;
+
+		if (currentNode == nodePtrTail) {
+			break;
+		}
+
+		currentNode = currentNode->getNextNode();
+	}
+
+	CheckPolicy::checkLink(currentNode == nodePtrTail);
+
+	if (nodePtrTail != nullptr) {
+		nodePtrTail->setNextNode(nullptr);
+	}
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//Deep copy into fresh storage, see appendNodesOf
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::List(const List& other) {
+	LINKEDLIST_TRACE(trace::Span span("List::List(const List&)", other.size, other.size));
+	size = 0;
+	multiDim = other.multiDim;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	appendNodesOf(other);
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//Takes over the nodes of other, leaving it empty
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::List(List&& other) noexcept : storage(std::move(other.storage)), searchPolicy(std::move(other.searchPolicy)) {
+	size = other.size;
+	multiDim = other.multiDim;
+	listHead = other.listHead;
+	listTail = other.listTail;
+	LINKEDLIST_STATS(listStats = other.listStats);
+
+	other.size = 0;
+	other.listHead = nullptr;
+	other.listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//The list owns its nodes and returns them to its storage
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::~List() {
+	LINKEDLIST_REGISTRY(memory::unregisterList(this));
+
+	clear();
 }
 
 /*-------Methods-------*/
 
-template <typename T>
-void linkedlist::singlelink::List<T>::setListHead(DataNode<T>* nodePtrHead) {
-	if (listHead != nullptr) {
-		delete listHead;
+//Trivially copyable values in contiguous storage are laid out with memcpy/memset
+//over one run of nodes instead of constructing each node separately.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::appendCopies(int count, const T& padValue) {
+	if (count <= 0) {
+		return;
+	}
+
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	if constexpr (std::is_trivially_copyable<DataNode<T>>::value && StoragePolicy::CONTIGUOUS_RUNS) {
+		DataNode<T>* run = storage.template allocateRun<DataNode<T>>(count);
+		LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>) * count, count));
+
+		unsigned char padBytes[sizeof(T)];
+		bool zeroPad = true;
+
+		std::memcpy(padBytes, &padValue, sizeof(T));
+
+		for (std::size_t i = 0; i < sizeof(T); i++) {
+			zeroPad = zeroPad && padBytes[i] == 0;
+		}
+
+		if (zeroPad) {
+			std::memset(static_cast<void*>(run), 0, sizeof(DataNode<T>) * count);
+		} else {
+			DataNode<T> prototype(padValue);
+			int filled = 1;
+
+			std::memcpy(static_cast<void*>(run), &prototype, sizeof(DataNode<T>));
+
+			while (filled < count) {
+				int chunk = filled < count - filled ? filled : count - filled;
+
+				std::memcpy(static_cast<void*>(run + filled), run, sizeof(DataNode<T>) * chunk);
+				filled += chunk;
+			}
+		}
+
+		linkRun(run, count);
+	} else {
+		for (int i = 0; i < count; i++) {
+			DataNode<T>* newNode = storage.template allocate<DataNode<T>>(padValue);
+			LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+			linkNode(newNode);
+		}
+	}
+}
+
+//Copies the values of source into nodes of this list. Only storages with CONTIGUOUS_RUNS,
+//i.e. PooledStorage, take all nodes from a single run linked in order, so the copy is laid
+//out sequentially in memory regardless of how scattered the source was. HeapStorage still
+//allocates one node per value, see its CONTIGUOUS_RUNS.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+template <typename SourceList>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::appendNodesOf(SourceList& source) {
+	int count = 0;
+
+	for (DataNode<T>* sourceNode = source.listHead; sourceNode != nullptr; sourceNode = sourceNode->getNextNode()) {
+		count += 1;
+	}
+
+	if (count == 0) {
+		return;
+	}
+
+	if constexpr (StoragePolicy::CONTIGUOUS_RUNS) {
+		policy::Guard<ThreadPolicy> guard(threadPolicy);
+		DataNode<T>* run = storage.template allocateRun<DataNode<T>>(count);
+		DataNode<T>* sourceNode = source.listHead;
+		LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>) * count, count));
+
+		for (int i = 0; i < count; i++) {
+			new (run + i) DataNode<T>(sourceNode->getValue());
+			sourceNode = sourceNode->getNextNode();
+		}
+
+		linkRun(run, count);
+	} else {
+		for (DataNode<T>* sourceNode = source.listHead; sourceNode != nullptr; sourceNode = sourceNode->getNextNode()) {
+			emplace_back(sourceNode->getValue());
+		}
+	}
+}
+
+//Chains count adjacent nodes and appends them to the list. The caller holds the guard.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::linkRun(DataNode<T>* run, int count) {
+	for (int i = 0; i < count - 1; i++) {
+		run[i].setNextNode(run + i + 1);
+	}
+
+	run[count - 1].setNextNode(nullptr);
+
+	if (listHead == nullptr) {
+		listHead = run;
+	} else {
+		listTail->setNextNode(run);
 	}
 
+	listTail = run + count - 1;
+	size += count;
+}
+
+//Replaces the head node with nodePtrHead, which the list adopts, and frees the old head
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::setListHead(DataNode<T>* nodePtrHead) requires StoragePolicy::ADOPTS_NODES {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* oldHead = listHead;
+
+	CheckPolicy::checkNode(nodePtrHead);
+
+	if (oldHead == nullptr) {
+		nodePtrHead->setNextNode(nullptr);
+		linkNode(nodePtrHead);
+
+		return;
+	}
+
+	nodePtrHead->setNextNode(oldHead->getNextNode());
 	listHead = nodePtrHead;
+
+	if (listTail == oldHead) {
+		listTail = nodePtrHead;
+	}
+
+	searchPolicy.onRemove(oldHead);
+	storage.deallocate(oldHead);
+	LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
 }
 
-template <typename T>
-void linkedlist::singlelink::List<T>::setListTail(DataNode<T>* nodePtrTail) {
-	if (listTail != nullptr) {
-		delete listTail;
+//Replaces the tail node with nodePtrTail, which the list adopts, and frees the old tail
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::setListTail(DataNode<T>* nodePtrTail) requires StoragePolicy::ADOPTS_NODES {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* oldTail = listTail;
+
+	CheckPolicy::checkNode(nodePtrTail);
+	nodePtrTail->setNextNode(nullptr);
+
+	if (oldTail == nullptr) {
+		linkNode(nodePtrTail);
+
+		return;
+	}
+
+	if (listHead == oldTail) {
+		listHead = nodePtrTail;
+	} else {
+		DataNode<T>* previous = listHead;
+
+		while (previous->getNextNode() != oldTail) {
+			previous = previous->getNextNode();
+		}
+
+		previous->setNextNode(nodePtrTail);
 	}
 
 	listTail = nodePtrTail;
+
+	searchPolicy.onRemove(oldTail);
+	storage.deallocate(oldTail);
+	LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
 }
 
-template <typename T>
-void linkedlist::singlelink::List<T>::setMultiDim(bool isMultiDim) {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::setMultiDim(bool isMultiDim) {
 	multiDim = isMultiDim;
 }
 
-template <typename T>
-void linkedlist::singlelink::List<T>::addElement(DataNode<T>* nodePtrNew) {
+//Appends nodePtrNew itself. The list takes ownership of it, so it must come from new.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::addElement(DataNode<T>* nodePtrNew) requires StoragePolicy::ADOPTS_NODES {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(nodePtrNew);
+	linkNode(nodePtrNew);
+}
+
+//Appends one node. The caller holds the guard.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::linkNode(DataNode<T>* nodePtrNew) {
 	if (listHead == nullptr) {
 		listHead = nodePtrNew;
 	} else {
@@ -297,52 +645,303 @@ void linkedlist::singlelink::List<T>::addElement(DataNode<T>* nodePtrNew) {
 	size += 1;
 }
 
-template <typename T>
-void linkedlist::singlelink::List<T>::append(T newValue) {
-	DataNode<T>* valueNode = new DataNode<T>(newValue);
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::fill(const T& fillValue) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
 
-	addElement(valueNode);
+	for (DataNode<T>* currentNode = listHead; currentNode != nullptr; currentNode = currentNode->getNextNode()) {
+		currentNode->setValue(fillValue);
+	}
 }
 
-template <typename T>
-void linkedlist::singlelink::List<T>::append2D(T newValue, int row, bool keepDims, T padValue) {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* currentNode = listHead;
+
+	while (currentNode != nullptr) {
+		DataNode<T>* nextNode = currentNode->getNextNode();
+
+		storage.deallocate(currentNode);
+		LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
 
+		currentNode = nextNode;
+	}
+
+	searchPolicy.reset();
+
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
 }
 
-template <typename T>
-int linkedlist::singlelink::List<T>::getSize() {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::append(const T& newValue) {
+	emplace_back(newValue);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::append(T&& newValue) {
+	emplace_back(std::move(newValue));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+template <typename... Args>
+inline T& linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::emplace_back(Args&&... args) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* valueNode = storage.template allocate<DataNode<T>>(std::in_place, std::forward<Args>(args)...);
+	LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+	linkNode(valueNode);
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+
+	return valueNode->getValue();
+}
+
+//Appends count values pulled from nextValue(T&), which returns false to give up. The nodes come
+//from this list's storage and are chained aside, then linked onto the tail once every value
+//arrived; if nextValue gives up they are freed again and the list is left unchanged.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+template <typename Producer>
+bool linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::appendFrom(int count, Producer nextValue) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* chainHead = nullptr;
+	DataNode<T>* chainTail = nullptr;
+
+	for (int i = 0; i < count; i++) {
+		T value{};
+
+		if (!nextValue(value)) {
+			while (chainHead != nullptr) {
+				DataNode<T>* nextNode = chainHead->getNextNode();
+
+				storage.deallocate(chainHead);
+				LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+
+				chainHead = nextNode;
+			}
+
+			return false;
+		}
+
+		DataNode<T>* newNode = storage.template allocate<DataNode<T>>(std::move(value));
+		LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+		if (chainTail == nullptr) {
+			chainHead = newNode;
+		} else {
+			chainTail->setNextNode(newNode);
+		}
+
+		chainTail = newNode;
+	}
+
+	if (chainHead != nullptr) {
+		if (listHead == nullptr) {
+			listHead = chainHead;
+		} else {
+			listTail->setNextNode(chainHead);
+		}
+
+		listTail = chainTail;
+		size += count;
+	}
+
+	return true;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+void linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::append2D(T newValue, int row, bool keepDims, T padValue) {
+
+}
+
+//Linear search from the head. A hit is handed to the search policy, which may relink
+//it closer to the head so that skewed lookups get cheaper over time.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::find(const T& searchValue) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* beforePrevious = nullptr;
+	DataNode<T>* previous = nullptr;
+	DataNode<T>* currentNode = listHead;
+	int probes = 0;
+
+	while (currentNode != nullptr) {
+		probes += 1;
+
+		if (currentNode->getValue() == searchValue) {
+			LINKEDLIST_STATS(stats::recordFind(listStats, probes, true));
+
+			if (!multiDim) {
+				searchPolicy.onHit(listHead, listTail, beforePrevious, previous, currentNode);
+			}
+
+			return currentNode;
+		}
+
+		beforePrevious = previous;
+		previous = currentNode;
+		currentNode = currentNode->getNextNode();
+	}
+
+	LINKEDLIST_STATS(stats::recordFind(listStats, probes, false));
+
+	return nullptr;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline bool linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::contains(const T& searchValue) {
+	return find(searchValue) != nullptr;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline int linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::getSize() {
 	return size;
 }
 
-template <typename T>
-int linkedlist::singlelink::List<T>::getRowSize(int row) {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+int linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::getRowSize(int row) {
 	return 0;
 }
 
-template <typename T>
-bool linkedlist::singlelink::List<T>::getMultiDim() {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline bool linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::getMultiDim() {
 	return multiDim;
 }
 
-template <typename T>
-linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::List<T>::getListHead() {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::getListHead() {
 	return listHead;
 }
 
-template <typename T>
-linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::List<T>::getListTail() {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::getListTail() {
 	return listTail;
 }
 
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::memory::MemoryUsage linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::memoryUsage() {
+	memory::MemoryUsage usage = memory::nodeUsage(size, sizeof(DataNode<T>), 2 * sizeof(DataNode<T>*), sizeof(T), sizeof(List));
+
+	usage.allocatorSlackBytes = storage.slackBytes(size, sizeof(DataNode<T>));
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline typename linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::Iterator linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::begin() {
+	return Iterator(listHead);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+inline typename linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::Iterator linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::end() {
+	return Iterator(nullptr);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy> linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::clone() {
+	LINKEDLIST_TRACE(trace::Span span("List::clone", size, size));
+
+	return List(*this);
+}
+
+//Copies into a list whose nodes come from targetStorage
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+template <typename TargetStorage>
+linkedlist::singlelink::List<T, TargetStorage, ThreadPolicy, CheckPolicy, SearchPolicy> linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::clone(const TargetStorage& targetStorage) {
+	LINKEDLIST_TRACE(trace::Span span("List::clone(storage)", size, size));
+	List<T, TargetStorage, ThreadPolicy, CheckPolicy, SearchPolicy> target(targetStorage);
+
+	target.multiDim = multiDim;
+	target.appendNodesOf(*this);
+
+	return target;
+}
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::memory::MemoryUsage linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::reportUsage(void* list) {
+	return static_cast<List*>(list)->memoryUsage();
+}
+#endif
+
+#ifdef LINKEDLIST_ENABLE_STATS
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::stats::ListStats linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::getStats() {
+	return listStats;
+}
+#endif
+
 //-------Operators-------//
 
-template <typename T>
-linkedlist::singlelink::DataNode<T>& linkedlist::singlelink::List<T>::operator[](int index) {
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::DataNode<T>& linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::operator[](LINKEDLIST_INDEX_TYPE index) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
 	DataNode<T>* currentNode = listHead;
+	int hops = index > 0 ? (int)index : 0;
 
-	if (multiDim) {
+	//Row indexing of 2D lists is not implemented, unchecked lists fall back to the flat walk
+	CheckPolicy::checkLink(!multiDim);
 
-	} else {
-		return (*currentNode)[index];
+	LINKEDLIST_STATS(stats::recordIndex(listStats, hops));
+	LINKEDLIST_PROFILE(profiler::recordTraversal(index.location, hops));
+
+	CheckPolicy::checkNode(currentNode);
+
+	for (int i = 0; i < hops; i++) {
+		currentNode = currentNode->getNextNode();
+		CheckPolicy::checkNode(currentNode);
+	}
+
+	return *currentNode;
+}
+
+//Copies the elements of other into this list's own storage, so a list built over a shared pool stays on it
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>& linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::operator=(const List& other) {
+	LINKEDLIST_TRACE(trace::Span span("List::operator=(const List&)", other.size, other.size));
+
+	if (this != &other) {
+		clear();
+		multiDim = other.multiDim;
+		appendNodesOf(other);
 	}
-}
\ No newline at end of file
+
+	return *this;
+}
+
+//Swaps contents with other, which then owns the nodes this list held before
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy, typename SearchPolicy>
+linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>& linkedlist::singlelink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy, SearchPolicy>::operator=(List&& other) noexcept {
+	if (this != &other) {
+		std::swap(size, other.size);
+		std::swap(multiDim, other.multiDim);
+		std::swap(listHead, other.listHead);
+		std::swap(listTail, other.listTail);
+		std::swap(storage, other.storage);
+		std::swap(searchPolicy, other.searchPolicy);
+		LINKEDLIST_STATS(std::swap(listStats, other.listStats));
+	}
+
+	return *this;
+}
+
+/**********************************************************************************************************/
+//                                 Explicit Instantiations                                                //
+/**********************************************************************************************************/
+
+//The common element types are compiled once into the LinkedList library (see src/LinkedList.cpp).
+//Define LINKEDLIST_HEADER_ONLY when using the header without linking the library.
+#ifndef LINKEDLIST_HEADER_ONLY
+extern template class linkedlist::singlelink::DataNode<int>;
+extern template class linkedlist::singlelink::DataNode<long>;
+extern template class linkedlist::singlelink::DataNode<float>;
+extern template class linkedlist::singlelink::DataNode<double>;
+extern template class linkedlist::singlelink::DataNode<std::string>;
+
+extern template class linkedlist::singlelink::List<int>;
+extern template class linkedlist::singlelink::List<long>;
+extern template class linkedlist::singlelink::List<float>;
+extern template class linkedlist::singlelink::List<double>;
+extern template class linkedlist::singlelink::List<std::string>;
+#endif
\ No newline at end of file
@@ -0,0 +1,185 @@
+// This file defines the compressed
+// on-disk format for lists holding
+// integral values.
+//
+// Each value is stored as the zigzag
+// encoded delta from the previous one,
+// written as a little endian base-128
+// varint. Sorted or slowly changing
+// data ends up using one or two bytes
+// per element.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <iostream>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "LinkedList.h"
+
+namespace linkedlist {
+
+	namespace codec {
+
+		//Stream header: magic bytes followed by the format version
+		const char MAGIC[4] = { 'L', 'L', 'D', 'V' };
+		const std::uint8_t VERSION = 1;
+
+		template <typename T, typename... Policies>
+		void encodeList(singlelink::List<T, Policies...>& list, std::ostream& outStream);
+
+		template <typename T, typename... Policies>
+		bool decodeList(std::istream& inStream, singlelink::List<T, Policies...>& list);
+
+		//Helpers
+		template <typename U>
+		U zigzagEncode(U delta);
+
+		template <typename U>
+		U zigzagDecode(U zigzag);
+
+		template <typename U>
+		void writeVarint(std::ostream& outStream, U value);
+
+		template <typename U>
+		bool readVarint(std::istream& inStream, U& value);
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Varint Helpers                                                         //
+/**********************************************************************************************************/
+
+template <typename U>
+U linkedlist::codec::zigzagEncode(U delta) {
+	const int bits = sizeof(U) * 8;
+
+	return (U)(delta << 1) ^ (U)(0 - (delta >> (bits - 1)));
+}
+
+template <typename U>
+U linkedlist::codec::zigzagDecode(U zigzag) {
+	return (U)(zigzag >> 1) ^ (U)(0 - (zigzag & 1));
+}
+
+template <typename U>
+void linkedlist::codec::writeVarint(std::ostream& outStream, U value) {
+	while (value >= 0x80) {
+		outStream.put((char)((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+
+	outStream.put((char)value);
+}
+
+//Rejects encodings longer than ceil(bits / 7) bytes, a final byte carrying bits that do not
+//fit in U, and a zero final byte after the first, which writeVarint never produces
+template <typename U>
+bool linkedlist::codec::readVarint(std::istream& inStream, U& value) {
+	const int bits = sizeof(U) * 8;
+	value = 0;
+
+	for (int shift = 0; shift < bits; shift += 7) {
+		int byte = inStream.get();
+
+		if (byte == std::char_traits<char>::eof()) {
+			return false;
+		}
+
+		if (bits - shift < 7 && ((byte & 0x7F) >> (bits - shift)) != 0) {
+			return false;
+		}
+
+		if (byte == 0 && shift > 0) {
+			return false;
+		}
+
+		value |= (U)(byte & 0x7F) << shift;
+
+		if ((byte & 0x80) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**********************************************************************************************************/
+//                                 Delta Varint Codec                                                     //
+/**********************************************************************************************************/
+
+template <typename T, typename... Policies>
+void linkedlist::codec::encodeList(singlelink::List<T, Policies...>& list, std::ostream& outStream) {
+	static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "encodeList requires an integral element type");
+	typedef typename std::make_unsigned<T>::type U;
+	LINKEDLIST_TRACE(trace::Span span("codec::encodeList", list.getSize(), list.getSize()));
+
+	outStream.write(MAGIC, sizeof(MAGIC));
+	outStream.put((char)VERSION);
+	outStream.put((char)sizeof(T));
+	writeVarint<std::uint64_t>(outStream, (std::uint64_t)list.getSize());
+
+	singlelink::DataNode<T>* currentNode = list.getListHead();
+	U previous = 0;
+
+	while (currentNode != nullptr) {
+		U current = (U)currentNode->getValue();
+
+		writeVarint<U>(outStream, zigzagEncode<U>((U)(current - previous)));
+
+		previous = current;
+		currentNode = currentNode->getNextNode();
+	}
+}
+
+//Appends the decoded values to list. On a malformed or truncated stream it returns false and list is unchanged.
+template <typename T, typename... Policies>
+bool linkedlist::codec::decodeList(std::istream& inStream, singlelink::List<T, Policies...>& list) {
+	static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "decodeList requires an integral element type");
+	typedef typename std::make_unsigned<T>::type U;
+	LINKEDLIST_TRACE(trace::Span span("codec::decodeList"));
+
+	char header[sizeof(MAGIC) + 2];
+
+	if (!inStream.read(header, sizeof(header))) {
+		return false;
+	}
+
+	for (unsigned i = 0; i < sizeof(MAGIC); i++) {
+		if (header[i] != MAGIC[i]) {
+			return false;
+		}
+	}
+
+	if ((std::uint8_t)header[sizeof(MAGIC)] != VERSION || (std::uint8_t)header[sizeof(MAGIC) + 1] != sizeof(T)) {
+		return false;
+	}
+
+	std::uint64_t count;
+
+	if (!readVarint<std::uint64_t>(inStream, count) || count > (std::uint64_t)(std::numeric_limits<int>::max() - list.getSize())) {
+		return false;
+	}
+
+	U previous = 0;
+	LINKEDLIST_TRACE(span.setElements((long long)count));
+
+	//Decoded straight into list's storage, which only links the values once the whole stream was read
+	return list.appendFrom((int)count, [&](T& value) {
+		U zigzag;
+
+		if (!readVarint<U>(inStream, zigzag)) {
+			return false;
+		}
+
+		previous = (U)(previous + zigzagDecode<U>(zigzag));
+		value = (T)previous;
+
+		return true;
+	});
+}
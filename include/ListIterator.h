@@ -0,0 +1,140 @@
+// This file defines the iterator
+// shared by the node based lists.
+//
+// It works with any node that has
+// getValue and getNextNode. Nodes
+// that also have getPrevNode get a
+// bidirectional iterator.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace linkedlist {
+
+	//Nodes that can be walked backwards
+	template <typename Node>
+	concept BackLinkedNode = requires(Node* node) {
+		{ node->getPrevNode() } -> std::same_as<Node*>;
+	};
+
+	//NodeIterator class
+	template <typename Node>
+	class NodeIterator {
+
+		private:
+			Node* currentNode;
+			//The owning list's tail pointer, read when stepping back from end()
+			Node* const* tailSlot;
+
+		public:
+			using value_type = std::remove_reference_t<decltype(std::declval<Node&>().getValue())>;
+			using reference = value_type&;
+			using pointer = value_type*;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::conditional_t<BackLinkedNode<Node>, std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+
+			NodeIterator();
+			NodeIterator(Node* node, Node* const* listTailSlot = nullptr);
+
+			Node* getNode() const;
+
+			//Overloaded operators
+			reference operator*() const;
+			pointer operator->() const;
+			NodeIterator& operator++();
+			NodeIterator operator++(int);
+			NodeIterator& operator--() requires BackLinkedNode<Node>;
+			NodeIterator operator--(int) requires BackLinkedNode<Node>;
+			bool operator==(const NodeIterator& other) const;
+			bool operator!=(const NodeIterator& other) const;
+
+	};
+
+}
+
+/**********************************************************************************************************/
+//                                 Node Iterator                                                          //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename Node>
+linkedlist::NodeIterator<Node>::NodeIterator() {
+	currentNode = nullptr;
+	tailSlot = nullptr;
+}
+
+template <typename Node>
+linkedlist::NodeIterator<Node>::NodeIterator(Node* node, Node* const* listTailSlot) {
+	currentNode = node;
+	tailSlot = listTailSlot;
+}
+
+//-------Methods-------//
+
+template <typename Node>
+inline Node* linkedlist::NodeIterator<Node>::getNode() const {
+	return currentNode;
+}
+
+//-------Operators-------//
+
+template <typename Node>
+inline typename linkedlist::NodeIterator<Node>::reference linkedlist::NodeIterator<Node>::operator*() const {
+	return currentNode->getValue();
+}
+
+template <typename Node>
+inline typename linkedlist::NodeIterator<Node>::pointer linkedlist::NodeIterator<Node>::operator->() const {
+	return &currentNode->getValue();
+}
+
+template <typename Node>
+inline linkedlist::NodeIterator<Node>& linkedlist::NodeIterator<Node>::operator++() {
+	currentNode = currentNode->getNextNode();
+
+	return *this;
+}
+
+template <typename Node>
+inline linkedlist::NodeIterator<Node> linkedlist::NodeIterator<Node>::operator++(int) {
+	NodeIterator previous = *this;
+
+	++(*this);
+
+	return previous;
+}
+
+template <typename Node>
+inline linkedlist::NodeIterator<Node>& linkedlist::NodeIterator<Node>::operator--() requires BackLinkedNode<Node> {
+	currentNode = currentNode == nullptr ? *tailSlot : currentNode->getPrevNode();
+
+	return *this;
+}
+
+template <typename Node>
+inline linkedlist::NodeIterator<Node> linkedlist::NodeIterator<Node>::operator--(int) requires BackLinkedNode<Node> {
+	NodeIterator previous = *this;
+
+	--(*this);
+
+	return previous;
+}
+
+template <typename Node>
+inline bool linkedlist::NodeIterator<Node>::operator==(const NodeIterator& other) const {
+	return currentNode == other.currentNode;
+}
+
+template <typename Node>
+inline bool linkedlist::NodeIterator<Node>::operator!=(const NodeIterator& other) const {
+	return currentNode != other.currentNode;
+}
@@ -0,0 +1,168 @@
+// This file defines the memory
+// footprint report returned by
+// List<T>::memoryUsage() and the
+// process wide registry of live lists
+// enabled by LINKEDLIST_ENABLE_MEMORY_REGISTRY.
+//
+// Reports are computed from the node
+// count alone, so they are O(1) and
+// safe to call from a metrics scrape.
+// Allocator slack is an estimate for
+// a 16 byte aligned malloc with an
+// 8 byte chunk header.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <iostream>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+namespace linkedlist {
+
+	namespace memory {
+
+		//Footprint breakdown of a single list
+		struct MemoryUsage {
+			std::size_t elements = 0;
+			std::size_t objectBytes = 0;
+			std::size_t nodeHeaderBytes = 0;
+			std::size_t payloadBytes = 0;
+			std::size_t paddingBytes = 0;
+			std::size_t allocatorSlackBytes = 0;
+			std::size_t indexBytes = 0;
+			std::size_t totalBytes = 0;
+			double bytesPerElement = 0;
+		};
+
+		typedef MemoryUsage (*UsageReporter)(void* list);
+
+		struct RegistryEntry {
+			const char* typeName;
+			UsageReporter reporter;
+		};
+
+		struct Registry {
+			std::mutex lock;
+			std::unordered_map<void*, RegistryEntry> lists;
+		};
+
+		std::size_t allocationSize(std::size_t requestBytes);
+		MemoryUsage nodeUsage(std::size_t nodes, std::size_t nodeBytes, std::size_t headerBytes, std::size_t payloadBytes, std::size_t objectBytes);
+		void finalizeUsage(MemoryUsage& usage);
+
+		Registry& registry();
+		void registerList(void* list, const char* typeName, UsageReporter reporter);
+		void unregisterList(void* list);
+		MemoryUsage totalUsage();
+		void dumpUsage(std::ostream& outStream);
+
+		std::ostream& operator<<(std::ostream& outStream, const MemoryUsage& usage);
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Usage Calculation                                                      //
+/**********************************************************************************************************/
+
+inline std::size_t linkedlist::memory::allocationSize(std::size_t requestBytes) {
+	std::size_t chunkBytes = (requestBytes + sizeof(void*) + 15) & ~(std::size_t)15;
+
+	return chunkBytes < 32 ? 32 : chunkBytes;
+}
+
+inline linkedlist::memory::MemoryUsage linkedlist::memory::nodeUsage(std::size_t nodes, std::size_t nodeBytes, std::size_t headerBytes, std::size_t payloadBytes, std::size_t objectBytes) {
+	MemoryUsage usage;
+
+	usage.elements = nodes;
+	usage.objectBytes = objectBytes;
+	usage.nodeHeaderBytes = nodes * headerBytes;
+	usage.payloadBytes = nodes * payloadBytes;
+	usage.paddingBytes = nodes * (nodeBytes - headerBytes - payloadBytes);
+	usage.allocatorSlackBytes = nodes * (allocationSize(nodeBytes) - nodeBytes);
+
+	finalizeUsage(usage);
+
+	return usage;
+}
+
+inline void linkedlist::memory::finalizeUsage(MemoryUsage& usage) {
+	usage.totalBytes = usage.objectBytes + usage.nodeHeaderBytes + usage.payloadBytes + usage.paddingBytes + usage.allocatorSlackBytes + usage.indexBytes;
+	usage.bytesPerElement = usage.elements == 0 ? 0 : (double)usage.totalBytes / (double)usage.elements;
+}
+
+/**********************************************************************************************************/
+//                                 Live List Registry                                                     //
+/**********************************************************************************************************/
+
+inline linkedlist::memory::Registry& linkedlist::memory::registry() {
+	static Registry data;
+
+	return data;
+}
+
+inline void linkedlist::memory::registerList(void* list, const char* typeName, UsageReporter reporter) {
+	Registry& data = registry();
+	std::lock_guard<std::mutex> guard(data.lock);
+
+	data.lists[list] = RegistryEntry{ typeName, reporter };
+}
+
+inline void linkedlist::memory::unregisterList(void* list) {
+	Registry& data = registry();
+	std::lock_guard<std::mutex> guard(data.lock);
+
+	data.lists.erase(list);
+}
+
+inline linkedlist::memory::MemoryUsage linkedlist::memory::totalUsage() {
+	Registry& data = registry();
+	std::lock_guard<std::mutex> guard(data.lock);
+	MemoryUsage total;
+
+	for (auto& entry : data.lists) {
+		MemoryUsage usage = entry.second.reporter(entry.first);
+
+		total.elements += usage.elements;
+		total.objectBytes += usage.objectBytes;
+		total.nodeHeaderBytes += usage.nodeHeaderBytes;
+		total.payloadBytes += usage.payloadBytes;
+		total.paddingBytes += usage.paddingBytes;
+		total.allocatorSlackBytes += usage.allocatorSlackBytes;
+		total.indexBytes += usage.indexBytes;
+	}
+
+	finalizeUsage(total);
+
+	return total;
+}
+
+inline void linkedlist::memory::dumpUsage(std::ostream& outStream) {
+	Registry& data = registry();
+	std::lock_guard<std::mutex> guard(data.lock);
+
+	for (auto& entry : data.lists) {
+		outStream << entry.second.typeName << ' ' << entry.first << ' ' << entry.second.reporter(entry.first) << std::endl;
+	}
+}
+
+//-------Operators-------//
+
+inline std::ostream& linkedlist::memory::operator<<(std::ostream& outStream, const MemoryUsage& usage) {
+	outStream << "elements=" << usage.elements
+		<< " object=" << usage.objectBytes
+		<< " nodeHeaders=" << usage.nodeHeaderBytes
+		<< " payload=" << usage.payloadBytes
+		<< " padding=" << usage.paddingBytes
+		<< " allocatorSlack=" << usage.allocatorSlackBytes
+		<< " index=" << usage.indexBytes
+		<< " total=" << usage.totalBytes
+		<< " bytesPerElement=" << usage.bytesPerElement;
+
+	return outStream;
+}
@@ -0,0 +1,672 @@
+// This file defines the policies that
+// configure List<T> at compile time:
+// where nodes are stored, how access
+// is synchronised, how indexing
+// is checked and how searches
+// reorder the list.
+//
+// The defaults (HeapStorage,
+// SingleThreaded, ExitOnOutOfRange,
+// NoReordering)
+// reproduce the original behaviour
+// and compile down to nothing extra.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ListMemory.h"
+
+namespace linkedlist {
+
+	namespace policy {
+
+		/**************************************************************************************************/
+		//                             Storage Policies                                                   //
+		/**************************************************************************************************/
+
+		//One heap allocation per node
+		struct HeapStorage {
+			//No contiguous runs: clear(), setListHead and setListTail delete nodes one at a time, and
+			//adopted nodes are mixed with the list's own, so every node is a separate allocation
+			static constexpr bool CONTIGUOUS_RUNS = false;
+			//Nodes are freed with delete, so a list can take over nodes the caller made with new
+			static constexpr bool ADOPTS_NODES = true;
+
+			template <typename Node, typename... Args>
+			Node* allocate(Args&&... args);
+
+			template <typename Node>
+			void deallocate(Node* node);
+
+			std::size_t slackBytes(std::size_t nodes, std::size_t nodeBytes);
+		};
+
+		//Nodes are carved out of blocks of BlockNodes slots and recycled through a free list.
+		//Lists built over the same PooledStorage, e.g. with List(const StoragePolicy&) or
+		//clone(storage), share its pool, which is released with its last user. A copy-constructed
+		//list starts a pool of its own, and copy assignment copies into the target's current pool.
+		//Once a pool is shared every call on it takes the pool mutex, since each list only holds its own lock.
+		template <std::size_t BlockNodes = 256>
+		class PooledStorage {
+
+			private:
+				struct FreeSlot {
+					FreeSlot* next;
+				};
+
+				struct Pool {
+					std::vector<char*> blocks;
+					FreeSlot* freeSlots = nullptr;
+					std::size_t slotBytes = 0;
+					std::size_t capacity = 0;
+					std::mutex mutex;
+					std::atomic<bool> shared = false;
+
+					~Pool();
+				};
+
+				std::shared_ptr<Pool> pool;
+
+				void grow(std::size_t slotBytes);
+				std::unique_lock<std::mutex> lockPool();
+
+				template <typename Node>
+				static constexpr std::size_t slotBytesFor();
+
+			public:
+				static constexpr bool CONTIGUOUS_RUNS = true;
+				//Freed nodes go onto the free list, which must only hold slots of this pool
+				static constexpr bool ADOPTS_NODES = false;
+
+				PooledStorage();
+				PooledStorage(const PooledStorage& other);
+				PooledStorage(PooledStorage&& other) noexcept;
+
+				PooledStorage& operator=(const PooledStorage& other);
+				PooledStorage& operator=(PooledStorage&& other) noexcept;
+
+				template <typename Node, typename... Args>
+				Node* allocate(Args&&... args);
+
+				template <typename Node>
+				Node* allocateRun(std::size_t count);
+
+				template <typename Node>
+				void deallocate(Node* node);
+
+				std::size_t slackBytes(std::size_t nodes, std::size_t nodeBytes);
+				std::size_t getCapacity();
+
+		};
+
+		/**************************************************************************************************/
+		//                             Thread Policies                                                    //
+		/**************************************************************************************************/
+
+		//No synchronisation
+		struct SingleThreaded {
+			void lock();
+			void unlock();
+		};
+
+		//Every mutating or walking call holds a mutex
+		class Locked {
+
+			private:
+				std::mutex mutex;
+
+			public:
+				Locked();
+				Locked(const Locked& other);
+				Locked& operator=(const Locked& other);
+
+				void lock();
+				void unlock();
+
+		};
+
+		//Busy waits on an atomic flag instead of sleeping in the kernel
+		class SpinLocked {
+
+			private:
+				std::atomic_flag flag = ATOMIC_FLAG_INIT;
+
+			public:
+				SpinLocked();
+				SpinLocked(const SpinLocked& other);
+				SpinLocked& operator=(const SpinLocked& other);
+
+				void lock();
+				void unlock();
+
+		};
+
+		//Scoped lock over any thread policy
+		template <typename ThreadPolicy>
+		class Guard {
+
+			private:
+				ThreadPolicy& threadPolicy;
+
+			public:
+				Guard(ThreadPolicy& policy);
+				~Guard();
+
+		};
+
+		/**************************************************************************************************/
+		//                             Check Policies                                                     //
+		/**************************************************************************************************/
+
+		//Exits with 139 when indexing walks off the end of the list or a link is misused
+		struct ExitOnOutOfRange {
+			//Containers may keep extra bookkeeping, e.g. the owner of a hook, to back the checks
+			static constexpr bool CHECKS_LINKS = true;
+
+			template <typename Node>
+			static void checkNode(Node* node);
+
+			static void checkLink(bool valid);
+		};
+
+		//No check on the walk
+		struct UncheckedIndex {
+			static constexpr bool CHECKS_LINKS = false;
+
+			template <typename Node>
+			static void checkNode(Node* node);
+
+			static void checkLink(bool valid);
+		};
+
+		/**************************************************************************************************/
+		//                             Search Policies                                                    //
+		/**************************************************************************************************/
+
+		//A search policy is told about every hit of List::find together with the two nodes
+		//in front of the hit (nullptr when there are none) and may relink the list in place.
+		//onRemove is called before the list frees a single node (setListHead, setListTail), so no
+		//state outlives the node's address; clear() drops every node at once and calls reset().
+
+		//Leaves the order alone
+		struct NoReordering {
+			template <typename Node>
+			void onHit(Node*& head, Node*& tail, Node* beforePrevious, Node* previous, Node* node);
+
+			template <typename Node>
+			void onRemove(Node* node);
+
+			void reset();
+		};
+
+		//Moves every hit to the head, so a hot key is found in one probe until something else is hit
+		struct MoveToFront {
+			template <typename Node>
+			void onHit(Node*& head, Node*& tail, Node* beforePrevious, Node* previous, Node* node);
+
+			template <typename Node>
+			void onRemove(Node* node);
+
+			void reset();
+		};
+
+		//Swaps every hit with the node in front of it, so only keys that stay hot drift to the head
+		struct Transpose {
+			template <typename Node>
+			void onHit(Node*& head, Node*& tail, Node* beforePrevious, Node* previous, Node* node);
+
+			template <typename Node>
+			void onRemove(Node* node);
+
+			void reset();
+		};
+
+		//Counts the hits of every node and keeps the list ordered by count.
+		//The counts live beside the nodes, so lists using other policies keep their node layout.
+		class FrequencyCount {
+
+			private:
+				std::unordered_map<const void*, unsigned long long> hitCounts;
+
+				unsigned long long countOf(const void* node);
+
+			public:
+				template <typename Node>
+				void onHit(Node*& head, Node*& tail, Node* beforePrevious, Node* previous, Node* node);
+
+				template <typename Node>
+				void onRemove(Node* node);
+
+				void reset();
+
+		};
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Heap Storage                                                           //
+/**********************************************************************************************************/
+
+template <typename Node, typename... Args>
+Node* linkedlist::policy::HeapStorage::allocate(Args&&... args) {
+	return new Node(std::forward<Args>(args)...);
+}
+
+template <typename Node>
+void linkedlist::policy::HeapStorage::deallocate(Node* node) {
+	delete node;
+}
+
+inline std::size_t linkedlist::policy::HeapStorage::slackBytes(std::size_t nodes, std::size_t nodeBytes) {
+	return nodes * (memory::allocationSize(nodeBytes) - nodeBytes);
+}
+
+/**********************************************************************************************************/
+//                                 Pooled Storage                                                         //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <std::size_t BlockNodes>
+linkedlist::policy::PooledStorage<BlockNodes>::PooledStorage() {
+	pool = std::make_shared<Pool>();
+}
+
+//The copy shares the pool, so from now on both sides lock it
+template <std::size_t BlockNodes>
+linkedlist::policy::PooledStorage<BlockNodes>::PooledStorage(const PooledStorage& other) : pool(other.pool) {
+	if (pool != nullptr) {
+		pool->shared = true;
+	}
+}
+
+//The moved-from storage is left without a pool and makes a new one on its next allocation
+template <std::size_t BlockNodes>
+linkedlist::policy::PooledStorage<BlockNodes>::PooledStorage(PooledStorage&& other) noexcept : pool(std::move(other.pool)) {
+
+}
+
+template <std::size_t BlockNodes>
+linkedlist::policy::PooledStorage<BlockNodes>::Pool::~Pool() {
+	for (char* block : blocks) {
+		::operator delete(block);
+	}
+}
+
+//-------Operators-------//
+
+template <std::size_t BlockNodes>
+linkedlist::policy::PooledStorage<BlockNodes>& linkedlist::policy::PooledStorage<BlockNodes>::operator=(const PooledStorage& other) {
+	pool = other.pool;
+
+	if (pool != nullptr) {
+		pool->shared = true;
+	}
+
+	return *this;
+}
+
+template <std::size_t BlockNodes>
+linkedlist::policy::PooledStorage<BlockNodes>& linkedlist::policy::PooledStorage<BlockNodes>::operator=(PooledStorage&& other) noexcept {
+	pool = std::move(other.pool);
+
+	return *this;
+}
+
+//-------Methods-------//
+
+//Creates the pool of a moved-from storage and locks it when another storage shares it
+template <std::size_t BlockNodes>
+std::unique_lock<std::mutex> linkedlist::policy::PooledStorage<BlockNodes>::lockPool() {
+	if (pool == nullptr) {
+		pool = std::make_shared<Pool>();
+	}
+
+	if (pool->shared) {
+		return std::unique_lock<std::mutex>(pool->mutex);
+	}
+
+	return std::unique_lock<std::mutex>();
+}
+
+template <std::size_t BlockNodes>
+void linkedlist::policy::PooledStorage<BlockNodes>::grow(std::size_t slotBytes) {
+	char* block = static_cast<char*>(::operator new(slotBytes * BlockNodes));
+
+	pool->blocks.push_back(block);
+	pool->capacity += BlockNodes;
+
+	for (std::size_t i = BlockNodes; i > 0; i--) {
+		FreeSlot* slot = reinterpret_cast<FreeSlot*>(block + (i - 1) * slotBytes);
+
+		slot->next = pool->freeSlots;
+		pool->freeSlots = slot;
+	}
+}
+
+template <std::size_t BlockNodes>
+template <typename Node>
+constexpr std::size_t linkedlist::policy::PooledStorage<BlockNodes>::slotBytesFor() {
+	const std::size_t alignment = alignof(Node) > alignof(FreeSlot) ? alignof(Node) : alignof(FreeSlot);
+
+	return ((sizeof(Node) > sizeof(FreeSlot) ? sizeof(Node) : sizeof(FreeSlot)) + alignment - 1) / alignment * alignment;
+}
+
+template <std::size_t BlockNodes>
+template <typename Node, typename... Args>
+Node* linkedlist::policy::PooledStorage<BlockNodes>::allocate(Args&&... args) {
+	std::unique_lock<std::mutex> poolLock = lockPool();
+
+	if (pool->slotBytes == 0) {
+		pool->slotBytes = slotBytesFor<Node>();
+	}
+
+	if (pool->freeSlots == nullptr) {
+		grow(pool->slotBytes);
+	}
+
+	FreeSlot* slot = pool->freeSlots;
+	pool->freeSlots = slot->next;
+	poolLock = std::unique_lock<std::mutex>();
+
+	return new (slot) Node(std::forward<Args>(args)...);
+}
+
+//Hands out a dedicated block of count uninitialised, contiguous node slots.
+//Each slot can later be passed to deallocate like any other node.
+template <std::size_t BlockNodes>
+template <typename Node>
+Node* linkedlist::policy::PooledStorage<BlockNodes>::allocateRun(std::size_t count) {
+	static_assert(slotBytesFor<Node>() == sizeof(Node), "pool slots must be exactly one node wide");
+
+	std::unique_lock<std::mutex> poolLock = lockPool();
+
+	if (pool->slotBytes == 0) {
+		pool->slotBytes = slotBytesFor<Node>();
+	}
+
+	char* block = static_cast<char*>(::operator new(sizeof(Node) * count));
+
+	pool->blocks.push_back(block);
+	pool->capacity += count;
+
+	return reinterpret_cast<Node*>(block);
+}
+
+template <std::size_t BlockNodes>
+template <typename Node>
+void linkedlist::policy::PooledStorage<BlockNodes>::deallocate(Node* node) {
+	node->~Node();
+
+	std::unique_lock<std::mutex> poolLock = lockPool();
+	FreeSlot* slot = reinterpret_cast<FreeSlot*>(node);
+
+	slot->next = pool->freeSlots;
+	pool->freeSlots = slot;
+}
+
+//Unused slots in the pool plus one malloc header per block
+template <std::size_t BlockNodes>
+std::size_t linkedlist::policy::PooledStorage<BlockNodes>::slackBytes(std::size_t nodes, std::size_t nodeBytes) {
+	if (pool == nullptr) {
+		return 0;
+	}
+
+	std::unique_lock<std::mutex> poolLock = lockPool();
+	std::size_t slotBytes = pool->slotBytes == 0 ? nodeBytes : pool->slotBytes;
+	std::size_t usedSlots = nodes < pool->capacity ? nodes : pool->capacity;
+
+	return (pool->capacity - usedSlots) * slotBytes + usedSlots * (slotBytes - nodeBytes) + pool->blocks.size() * sizeof(void*);
+}
+
+template <std::size_t BlockNodes>
+std::size_t linkedlist::policy::PooledStorage<BlockNodes>::getCapacity() {
+	if (pool == nullptr) {
+		return 0;
+	}
+
+	std::unique_lock<std::mutex> poolLock = lockPool();
+
+	return pool->capacity;
+}
+
+/**********************************************************************************************************/
+//                                 Thread Policies                                                        //
+/**********************************************************************************************************/
+
+inline void linkedlist::policy::SingleThreaded::lock() {
+
+}
+
+inline void linkedlist::policy::SingleThreaded::unlock() {
+
+}
+
+//-------Locked-------//
+
+inline linkedlist::policy::Locked::Locked() {
+
+}
+
+//Copies get their own mutex
+inline linkedlist::policy::Locked::Locked(const Locked&) {
+
+}
+
+inline linkedlist::policy::Locked& linkedlist::policy::Locked::operator=(const Locked&) {
+	return *this;
+}
+
+inline void linkedlist::policy::Locked::lock() {
+	mutex.lock();
+}
+
+inline void linkedlist::policy::Locked::unlock() {
+	mutex.unlock();
+}
+
+//-------SpinLocked-------//
+
+inline linkedlist::policy::SpinLocked::SpinLocked() {
+
+}
+
+//Copies get their own flag
+inline linkedlist::policy::SpinLocked::SpinLocked(const SpinLocked&) {
+
+}
+
+inline linkedlist::policy::SpinLocked& linkedlist::policy::SpinLocked::operator=(const SpinLocked&) {
+	return *this;
+}
+
+inline void linkedlist::policy::SpinLocked::lock() {
+	while (flag.test_and_set(std::memory_order_acquire)) {
+
+	}
+}
+
+inline void linkedlist::policy::SpinLocked::unlock() {
+	flag.clear(std::memory_order_release);
+}
+
+//-------Guard-------//
+
+template <typename ThreadPolicy>
+linkedlist::policy::Guard<ThreadPolicy>::Guard(ThreadPolicy& policy) : threadPolicy(policy) {
+	threadPolicy.lock();
+}
+
+template <typename ThreadPolicy>
+linkedlist::policy::Guard<ThreadPolicy>::~Guard() {
+	threadPolicy.unlock();
+}
+
+/**********************************************************************************************************/
+//                                 Check Policies                                                         //
+/**********************************************************************************************************/
+
+template <typename Node>
+void linkedlist::policy::ExitOnOutOfRange::checkNode(Node* node) {
+	if (node == nullptr) {
+		exit(139);
+	}
+}
+
+inline void linkedlist::policy::ExitOnOutOfRange::checkLink(bool valid) {
+	if (!valid) {
+		exit(139);
+	}
+}
+
+template <typename Node>
+void linkedlist::policy::UncheckedIndex::checkNode(Node*) {
+
+}
+
+inline void linkedlist::policy::UncheckedIndex::checkLink(bool) {
+
+}
+
+/**********************************************************************************************************/
+//                                 Search Policies                                                        //
+/**********************************************************************************************************/
+
+template <typename Node>
+void linkedlist::policy::NoReordering::onHit(Node*&, Node*&, Node*, Node*, Node*) {
+
+}
+
+template <typename Node>
+void linkedlist::policy::NoReordering::onRemove(Node*) {
+
+}
+
+inline void linkedlist::policy::NoReordering::reset() {
+
+}
+
+//-------MoveToFront-------//
+
+template <typename Node>
+void linkedlist::policy::MoveToFront::onHit(Node*& head, Node*& tail, Node*, Node* previous, Node* node) {
+	if (previous == nullptr) {
+		return;
+	}
+
+	previous->setNextNode(node->getNextNode());
+
+	if (tail == node) {
+		tail = previous;
+	}
+
+	node->setNextNode(head);
+	head = node;
+}
+
+template <typename Node>
+void linkedlist::policy::MoveToFront::onRemove(Node*) {
+
+}
+
+inline void linkedlist::policy::MoveToFront::reset() {
+
+}
+
+//-------Transpose-------//
+
+template <typename Node>
+void linkedlist::policy::Transpose::onHit(Node*& head, Node*& tail, Node* beforePrevious, Node* previous, Node* node) {
+	if (previous == nullptr) {
+		return;
+	}
+
+	if (beforePrevious == nullptr) {
+		head = node;
+	} else {
+		beforePrevious->setNextNode(node);
+	}
+
+	previous->setNextNode(node->getNextNode());
+	node->setNextNode(previous);
+
+	if (tail == node) {
+		tail = previous;
+	}
+}
+
+template <typename Node>
+void linkedlist::policy::Transpose::onRemove(Node*) {
+
+}
+
+inline void linkedlist::policy::Transpose::reset() {
+
+}
+
+//-------FrequencyCount-------//
+
+inline unsigned long long linkedlist::policy::FrequencyCount::countOf(const void* node) {
+	auto entry = hitCounts.find(node);
+
+	return entry == hitCounts.end() ? 0 : entry->second;
+}
+
+//Everything in front of the hit was hit at least as often, so the node only has to pass
+//the run of nodes with its old count. That run is found with a second walk from the head.
+template <typename Node>
+void linkedlist::policy::FrequencyCount::onHit(Node*& head, Node*& tail, Node*, Node* previous, Node* node) {
+	unsigned long long hits = ++hitCounts[node];
+
+	if (previous == nullptr) {
+		return;
+	}
+
+	Node* insertAfter = nullptr;
+	Node* currentNode = head;
+
+	while (currentNode != node && countOf(currentNode) >= hits) {
+		insertAfter = currentNode;
+		currentNode = currentNode->getNextNode();
+	}
+
+	if (currentNode == node) {
+		return;
+	}
+
+	previous->setNextNode(node->getNextNode());
+
+	if (tail == node) {
+		tail = previous;
+	}
+
+	if (insertAfter == nullptr) {
+		node->setNextNode(head);
+		head = node;
+	} else {
+		node->setNextNode(insertAfter->getNextNode());
+		insertAfter->setNextNode(node);
+	}
+}
+
+template <typename Node>
+void linkedlist::policy::FrequencyCount::onRemove(Node* node) {
+	hitCounts.erase(node);
+}
+
+inline void linkedlist::policy::FrequencyCount::reset() {
+	hitCounts.clear();
+}
@@ -0,0 +1,196 @@
+// This file defines the access
+// pattern profiler used when the
+// library is built with
+// LINKEDLIST_ENABLE_PROFILER.
+//
+// Every indexed access records the
+// calling site and the number of
+// nodes walked. Sites whose total
+// walk grows faster than their call
+// count (the classic loop over
+// operator[]) are flagged in the
+// report printed at exit.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <iostream>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <source_location>
+
+namespace linkedlist {
+
+	namespace profiler {
+
+		const int HISTOGRAM_BUCKETS = 32;
+
+		//Index argument that captures the caller's location on conversion from int
+		struct IndexSite {
+			int value;
+			std::source_location location;
+
+			IndexSite(int index, std::source_location site = std::source_location::current());
+
+			operator int() const;
+		};
+
+		//Per call site counters
+		struct SiteProfile {
+			std::string file;
+			std::string function;
+			unsigned line = 0;
+
+			unsigned long long calls = 0;
+			unsigned long long totalHops = 0;
+			unsigned long long maxHops = 0;
+			unsigned long long checkpointHops = 0;
+			double growth = 0;
+			bool superlinear = false;
+		};
+
+		struct ProfileData {
+			std::mutex lock;
+			std::map<std::tuple<const char*, unsigned, unsigned>, SiteProfile> sites;
+			unsigned long long histogram[HISTOGRAM_BUCKETS] = {};
+			bool reportAtExit = true;
+		};
+
+		ProfileData& profileData();
+		int histogramBucket(unsigned long long hops);
+		void recordTraversal(const std::source_location& location, unsigned long long hops);
+		void setReportAtExit(bool enabled);
+		void report(std::ostream& outStream);
+		void reset();
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Index Site                                                             //
+/**********************************************************************************************************/
+
+inline linkedlist::profiler::IndexSite::IndexSite(int index, std::source_location site) {
+	value = index;
+	location = site;
+}
+
+inline linkedlist::profiler::IndexSite::operator int() const {
+	return value;
+}
+
+/**********************************************************************************************************/
+//                                 Profile Data                                                           //
+/**********************************************************************************************************/
+
+inline linkedlist::profiler::ProfileData& linkedlist::profiler::profileData() {
+	static ProfileData data;
+
+	//Thread-safe static initialisation registers the report exactly once, after data exists
+	[[maybe_unused]] static const bool registered = std::atexit([]() {
+		if (profileData().reportAtExit) {
+			report(std::cerr);
+		}
+	}) == 0;
+
+	return data;
+}
+
+inline int linkedlist::profiler::histogramBucket(unsigned long long hops) {
+	int bucket = 0;
+
+	while (hops > 0 && bucket < HISTOGRAM_BUCKETS - 1) {
+		hops >>= 1;
+		bucket += 1;
+	}
+
+	return bucket;
+}
+
+//A site is checked every time its call count reaches a power of two. Linear
+//sites roughly double their total hops between checkpoints, quadratic ones
+//roughly quadruple it.
+inline void linkedlist::profiler::recordTraversal(const std::source_location& location, unsigned long long hops) {
+	ProfileData& data = profileData();
+	std::lock_guard<std::mutex> guard(data.lock);
+
+	data.histogram[histogramBucket(hops)] += 1;
+
+	SiteProfile& site = data.sites[std::make_tuple(location.file_name(), location.line(), location.column())];
+
+	if (site.calls == 0) {
+		site.file = location.file_name();
+		site.function = location.function_name();
+		site.line = location.line();
+	}
+
+	site.calls += 1;
+	site.totalHops += hops;
+
+	if (hops > site.maxHops) {
+		site.maxHops = hops;
+	}
+
+	if ((site.calls & (site.calls - 1)) == 0) {
+		if (site.checkpointHops > 0 && site.calls >= 64) {
+			site.growth = (double)site.totalHops / (double)site.checkpointHops;
+
+			if (site.growth > 3.0) {
+				site.superlinear = true;
+			}
+		}
+
+		site.checkpointHops = site.totalHops;
+	}
+}
+
+inline void linkedlist::profiler::setReportAtExit(bool enabled) {
+	profileData().reportAtExit = enabled;
+}
+
+inline void linkedlist::profiler::report(std::ostream& outStream) {
+	ProfileData& data = profileData();
+	std::lock_guard<std::mutex> guard(data.lock);
+
+	outStream << "linkedlist profiler: traversal length histogram" << std::endl;
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		if (data.histogram[i] != 0) {
+			unsigned long long low = i == 0 ? 0 : 1ULL << (i - 1);
+			unsigned long long high = i == 0 ? 0 : (1ULL << i) - 1;
+
+			outStream << "  [" << low << ", " << high << "] " << data.histogram[i] << std::endl;
+		}
+	}
+
+	outStream << "linkedlist profiler: call sites" << std::endl;
+
+	for (auto& entry : data.sites) {
+		SiteProfile& site = entry.second;
+
+		outStream << (site.superlinear ? "  SUPERLINEAR " : "  ")
+			<< site.file << ':' << site.line << ' ' << site.function
+			<< " calls=" << site.calls
+			<< " totalHops=" << site.totalHops
+			<< " avgHops=" << (double)site.totalHops / (double)site.calls
+			<< " maxHops=" << site.maxHops
+			<< " growth=" << site.growth << std::endl;
+	}
+}
+
+inline void linkedlist::profiler::reset() {
+	ProfileData& data = profileData();
+	std::lock_guard<std::mutex> guard(data.lock);
+
+	data.sites.clear();
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		data.histogram[i] = 0;
+	}
+}
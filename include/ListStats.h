@@ -0,0 +1,168 @@
+// This file defines the allocation
+// and traversal statistics that a
+// list collects when the library is
+// built with LINKEDLIST_ENABLE_STATS.
+//
+// Without the flag none of this is
+// referenced by the list classes and
+// instrumentation costs nothing.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <iostream>
+#include <cstddef>
+
+namespace linkedlist {
+
+	namespace stats {
+
+		//Snapshot of the counters kept per list
+		struct ListStats {
+			unsigned long long allocations = 0;
+			unsigned long long frees = 0;
+			unsigned long long bytesInUse = 0;
+
+			unsigned long long indexCalls = 0;
+			unsigned long long indexHops = 0;
+			unsigned long long maxIndexHops = 0;
+
+			unsigned long long appendCalls = 0;
+			unsigned long long appendHops = 0;
+			unsigned long long maxAppendHops = 0;
+
+			unsigned long long findCalls = 0;
+			unsigned long long findHits = 0;
+			unsigned long long findProbes = 0;
+			unsigned long long maxFindProbes = 0;
+
+			unsigned long long operations = 0;
+		};
+
+		//Export hook, called with a snapshot every `period` recorded operations
+		typedef void (*StatsHook)(const ListStats& snapshot);
+
+		void setStatsHook(StatsHook hook, unsigned long long period);
+		StatsHook& statsHook();
+		unsigned long long& statsPeriod();
+
+		void recordAllocation(ListStats& listStats, std::size_t bytes, unsigned long long count = 1);
+		void recordFree(ListStats& listStats, std::size_t bytes);
+		void recordIndex(ListStats& listStats, unsigned long long hops);
+		void recordAppend(ListStats& listStats, unsigned long long hops);
+		void recordFind(ListStats& listStats, unsigned long long probes, bool hit);
+		double averageFindProbes(const ListStats& listStats);
+		void tick(ListStats& listStats);
+
+		std::ostream& operator<<(std::ostream& outStream, const ListStats& listStats);
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Export Hook                                                            //
+/**********************************************************************************************************/
+
+inline linkedlist::stats::StatsHook& linkedlist::stats::statsHook() {
+	static StatsHook hook = nullptr;
+
+	return hook;
+}
+
+inline unsigned long long& linkedlist::stats::statsPeriod() {
+	static unsigned long long period = 0;
+
+	return period;
+}
+
+inline void linkedlist::stats::setStatsHook(StatsHook hook, unsigned long long period) {
+	statsHook() = hook;
+	statsPeriod() = period;
+}
+
+/**********************************************************************************************************/
+//                                 Counters                                                               //
+/**********************************************************************************************************/
+
+inline void linkedlist::stats::recordAllocation(ListStats& listStats, std::size_t bytes, unsigned long long count) {
+	listStats.allocations += count;
+	listStats.bytesInUse += bytes;
+}
+
+inline void linkedlist::stats::recordFree(ListStats& listStats, std::size_t bytes) {
+	listStats.frees += 1;
+	listStats.bytesInUse -= bytes;
+}
+
+inline void linkedlist::stats::recordIndex(ListStats& listStats, unsigned long long hops) {
+	listStats.indexCalls += 1;
+	listStats.indexHops += hops;
+
+	if (hops > listStats.maxIndexHops) {
+		listStats.maxIndexHops = hops;
+	}
+
+	tick(listStats);
+}
+
+inline void linkedlist::stats::recordAppend(ListStats& listStats, unsigned long long hops) {
+	listStats.appendCalls += 1;
+	listStats.appendHops += hops;
+
+	if (hops > listStats.maxAppendHops) {
+		listStats.maxAppendHops = hops;
+	}
+
+	tick(listStats);
+}
+
+//probes counts the nodes compared, so a hit on the head costs one probe
+inline void linkedlist::stats::recordFind(ListStats& listStats, unsigned long long probes, bool hit) {
+	listStats.findCalls += 1;
+	listStats.findProbes += probes;
+
+	if (hit) {
+		listStats.findHits += 1;
+	}
+
+	if (probes > listStats.maxFindProbes) {
+		listStats.maxFindProbes = probes;
+	}
+
+	tick(listStats);
+}
+
+inline double linkedlist::stats::averageFindProbes(const ListStats& listStats) {
+	return listStats.findCalls == 0 ? 0.0 : (double)listStats.findProbes / (double)listStats.findCalls;
+}
+
+inline void linkedlist::stats::tick(ListStats& listStats) {
+	listStats.operations += 1;
+
+	if (statsHook() != nullptr && statsPeriod() != 0 && listStats.operations % statsPeriod() == 0) {
+		statsHook()(listStats);
+	}
+}
+
+//-------Operators-------//
+
+inline std::ostream& linkedlist::stats::operator<<(std::ostream& outStream, const ListStats& listStats) {
+	outStream << "allocations=" << listStats.allocations
+		<< " frees=" << listStats.frees
+		<< " bytesInUse=" << listStats.bytesInUse
+		<< " indexCalls=" << listStats.indexCalls
+		<< " indexHops=" << listStats.indexHops
+		<< " maxIndexHops=" << listStats.maxIndexHops
+		<< " appendCalls=" << listStats.appendCalls
+		<< " appendHops=" << listStats.appendHops
+		<< " maxAppendHops=" << listStats.maxAppendHops
+		<< " findCalls=" << listStats.findCalls
+		<< " findHits=" << listStats.findHits
+		<< " avgFindProbes=" << averageFindProbes(listStats)
+		<< " maxFindProbes=" << listStats.maxFindProbes;
+
+	return outStream;
+}
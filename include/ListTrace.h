@@ -0,0 +1,273 @@
+// This file defines the tracing spans
+// recorded around expensive list
+// operations when the library is
+// built with LINKEDLIST_ENABLE_TRACE.
+//
+// Each thread appends completed spans
+// to its own fixed size buffer without
+// taking a lock. When the thread exits
+// its spans are moved to a compact list
+// and the buffer is freed. writeTrace()
+// turns every span into a Chrome trace
+// / Perfetto JSON file, together with
+// the number of spans dropped because
+// a buffer was full.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace linkedlist {
+
+	namespace trace {
+
+		const int BUFFER_CAPACITY = 1 << 16;
+
+		//One completed span
+		struct TraceEvent {
+			const char* name;
+			long long startNs;
+			long long durationNs;
+			long long elements;
+			long long hops;
+		};
+
+		//Written only by its owning thread, read by writeTrace()
+		struct ThreadBuffer {
+			unsigned long long threadId;
+			std::atomic<int> count;
+			std::atomic<long long> dropped;
+			TraceEvent events[BUFFER_CAPACITY];
+		};
+
+		//Spans of a thread that has exited
+		struct RetiredEvents {
+			unsigned long long threadId;
+			std::vector<TraceEvent> events;
+		};
+
+		//Hands the buffer of its thread back to the registry at thread exit
+		struct BufferHandle {
+			ThreadBuffer* buffer = nullptr;
+
+			~BufferHandle();
+		};
+
+		struct TraceData {
+			std::mutex lock;
+			std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+			std::vector<RetiredEvents> retired;
+			unsigned long long threadCount = 0;
+			long long retiredDropped = 0;
+			std::string outputPath;
+			std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+		};
+
+		//Span class
+		class Span {
+
+			private:
+				const char* name;
+				long long startNs;
+				long long elements;
+				long long hops;
+
+			public:
+				Span(const char* spanName, long long spanElements = 0, long long spanHops = 0);
+				~Span();
+
+				void setElements(long long spanElements);
+				void setHops(long long spanHops);
+				void addHops(long long spanHops);
+
+		};
+
+		TraceData& traceData();
+		ThreadBuffer& threadBuffer();
+		long long nowNs();
+		void record(const TraceEvent& event);
+		void setOutputFile(const std::string& path);
+		void writeEvent(std::ostream& outStream, const TraceEvent& event, unsigned long long threadId, bool firstEvent);
+		bool writeTrace(const std::string& path);
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Trace Buffers                                                          //
+/**********************************************************************************************************/
+
+inline linkedlist::trace::TraceData& linkedlist::trace::traceData() {
+	static TraceData data;
+
+	return data;
+}
+
+//The buffer is owned by the registry, which keeps its spans once the thread is gone
+inline linkedlist::trace::ThreadBuffer& linkedlist::trace::threadBuffer() {
+	thread_local BufferHandle handle;
+
+	if (handle.buffer == nullptr) {
+		TraceData& data = traceData();
+		std::lock_guard<std::mutex> guard(data.lock);
+
+		data.buffers.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer()));
+		handle.buffer = data.buffers.back().get();
+		handle.buffer->threadId = ++data.threadCount;
+		handle.buffer->count.store(0);
+		handle.buffer->dropped.store(0);
+	}
+
+	return *handle.buffer;
+}
+
+//Copies the recorded spans out and frees the buffer
+inline linkedlist::trace::BufferHandle::~BufferHandle() {
+	if (buffer == nullptr) {
+		return;
+	}
+
+	TraceData& data = traceData();
+	std::lock_guard<std::mutex> guard(data.lock);
+	int count = buffer->count.load(std::memory_order_acquire);
+
+	data.retired.push_back(RetiredEvents{ buffer->threadId, std::vector<TraceEvent>(buffer->events, buffer->events + count) });
+	data.retiredDropped += buffer->dropped.load(std::memory_order_relaxed);
+
+	for (std::size_t i = 0; i < data.buffers.size(); i++) {
+		if (data.buffers[i].get() == buffer) {
+			data.buffers.erase(data.buffers.begin() + i);
+			break;
+		}
+	}
+
+	buffer = nullptr;
+}
+
+inline long long linkedlist::trace::nowNs() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceData().epoch).count();
+}
+
+inline void linkedlist::trace::record(const TraceEvent& event) {
+	ThreadBuffer& buffer = threadBuffer();
+	int index = buffer.count.load(std::memory_order_relaxed);
+
+	if (index >= BUFFER_CAPACITY) {
+		buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	buffer.events[index] = event;
+	buffer.count.store(index + 1, std::memory_order_release);
+}
+
+/**********************************************************************************************************/
+//                                 Trace Output                                                           //
+/**********************************************************************************************************/
+
+inline void linkedlist::trace::setOutputFile(const std::string& path) {
+	TraceData& data = traceData();
+	bool firstCall;
+
+	{
+		std::lock_guard<std::mutex> guard(data.lock);
+
+		firstCall = data.outputPath.empty();
+		data.outputPath = path;
+	}
+
+	if (firstCall) {
+		std::atexit([]() {
+			writeTrace(traceData().outputPath);
+		});
+	}
+}
+
+inline void linkedlist::trace::writeEvent(std::ostream& outStream, const TraceEvent& event, unsigned long long threadId, bool firstEvent) {
+	outStream << (firstEvent ? "\n" : ",\n")
+		<< "{\"name\":\"" << event.name << "\",\"cat\":\"linkedlist\",\"ph\":\"X\""
+		<< ",\"pid\":1,\"tid\":" << threadId
+		<< ",\"ts\":" << event.startNs / 1000 << '.' << (event.startNs % 1000) / 100
+		<< ",\"dur\":" << event.durationNs / 1000 << '.' << (event.durationNs % 1000) / 100
+		<< ",\"args\":{\"elements\":" << event.elements << ",\"hops\":" << event.hops << "}}";
+}
+
+//Spans of exited threads come first. Dropped spans are reported under otherData.
+inline bool linkedlist::trace::writeTrace(const std::string& path) {
+	TraceData& data = traceData();
+	std::lock_guard<std::mutex> guard(data.lock);
+	std::ofstream outFile(path);
+	long long dropped = data.retiredDropped;
+	bool firstEvent = true;
+
+	if (!outFile) {
+		return false;
+	}
+
+	outFile << "{\"traceEvents\":[";
+
+	for (RetiredEvents& retired : data.retired) {
+		for (TraceEvent& event : retired.events) {
+			writeEvent(outFile, event, retired.threadId, firstEvent);
+			firstEvent = false;
+		}
+	}
+
+	for (std::unique_ptr<ThreadBuffer>& buffer : data.buffers) {
+		int count = buffer->count.load(std::memory_order_acquire);
+
+		for (int i = 0; i < count; i++) {
+			writeEvent(outFile, buffer->events[i], buffer->threadId, firstEvent);
+			firstEvent = false;
+		}
+
+		dropped += buffer->dropped.load(std::memory_order_relaxed);
+	}
+
+	outFile << "\n],\"otherData\":{\"droppedEvents\":" << dropped << "}}" << std::endl;
+
+	return (bool)outFile;
+}
+
+/**********************************************************************************************************/
+//                                 Span                                                                   //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+inline linkedlist::trace::Span::Span(const char* spanName, long long spanElements, long long spanHops) {
+	name = spanName;
+	elements = spanElements;
+	hops = spanHops;
+	startNs = nowNs();
+}
+
+inline linkedlist::trace::Span::~Span() {
+	record(TraceEvent{ name, startNs, nowNs() - startNs, elements, hops });
+}
+
+//-------Methods-------//
+
+inline void linkedlist::trace::Span::setElements(long long spanElements) {
+	elements = spanElements;
+}
+
+inline void linkedlist::trace::Span::setHops(long long spanHops) {
+	hops = spanHops;
+}
+
+inline void linkedlist::trace::Span::addHops(long long spanHops) {
+	hops += spanHops;
+}
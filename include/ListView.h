@@ -0,0 +1,163 @@
+// This file defines a non-owning
+// view that presents an external
+// buffer of records through the
+// same read interface as a list.
+//
+// The view never allocates: indexing
+// is pointer arithmetic over a
+// contiguous or strided buffer.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <iostream>
+#include <cstddef>
+#include <cstdlib>
+
+namespace linkedlist {
+
+	//ListView class
+	template <typename T>
+	class ListView {
+
+		private:
+			const char* buffer;
+			int size;
+			std::size_t stride;
+
+		public:
+			//ListView iterator
+			class Iterator {
+
+				private:
+					const char* position;
+					std::size_t stride;
+
+				public:
+					Iterator(const char* bufferPos, std::size_t elementStride);
+
+					const T& operator*();
+					Iterator& operator++();
+					bool operator!=(const Iterator& other);
+
+			};
+
+			ListView();
+			ListView(const T* data, int length);
+			ListView(const T* data, int length, std::size_t strideBytes);
+
+			int getSize();
+			std::size_t getStride();
+			const T* getData();
+
+			Iterator begin();
+			Iterator end();
+
+			//Overloaded operators
+			const T& operator[](int index);
+
+			friend std::ostream& operator<<(std::ostream& outStream, ListView<T>& view) {
+				for (const T& value : view) {
+					outStream << value << ' ';
+				}
+
+				return outStream;
+			}
+
+	};
+
+}
+
+/**********************************************************************************************************/
+//                                 List View Iterator                                                     //
+/**********************************************************************************************************/
+
+template <typename T>
+linkedlist::ListView<T>::Iterator::Iterator(const char* bufferPos, std::size_t elementStride) {
+	position = bufferPos;
+	stride = elementStride;
+}
+
+template <typename T>
+const T& linkedlist::ListView<T>::Iterator::operator*() {
+	return *reinterpret_cast<const T*>(position);
+}
+
+template <typename T>
+typename linkedlist::ListView<T>::Iterator& linkedlist::ListView<T>::Iterator::operator++() {
+	position += stride;
+
+	return *this;
+}
+
+template <typename T>
+bool linkedlist::ListView<T>::Iterator::operator!=(const Iterator& other) {
+	return position != other.position;
+}
+
+/**********************************************************************************************************/
+//                                 List View                                                              //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T>
+linkedlist::ListView<T>::ListView() {
+	buffer = nullptr;
+	size = 0;
+	stride = sizeof(T);
+}
+
+template <typename T>
+linkedlist::ListView<T>::ListView(const T* data, int length) {
+	buffer = reinterpret_cast<const char*>(data);
+	size = length;
+	stride = sizeof(T);
+}
+
+template <typename T>
+linkedlist::ListView<T>::ListView(const T* data, int length, std::size_t strideBytes) {
+	buffer = reinterpret_cast<const char*>(data);
+	size = length;
+	stride = strideBytes;
+}
+
+//-------Methods-------//
+
+template <typename T>
+int linkedlist::ListView<T>::getSize() {
+	return size;
+}
+
+template <typename T>
+std::size_t linkedlist::ListView<T>::getStride() {
+	return stride;
+}
+
+template <typename T>
+const T* linkedlist::ListView<T>::getData() {
+	return reinterpret_cast<const T*>(buffer);
+}
+
+template <typename T>
+typename linkedlist::ListView<T>::Iterator linkedlist::ListView<T>::begin() {
+	return Iterator(buffer, stride);
+}
+
+template <typename T>
+typename linkedlist::ListView<T>::Iterator linkedlist::ListView<T>::end() {
+	return Iterator(buffer + stride * size, stride);
+}
+
+//-------Operators-------//
+
+template <typename T>
+const T& linkedlist::ListView<T>::operator[](int index) {
+	if (index < 0 || index >= size) {
+		exit(139);
+	}
+
+	return *reinterpret_cast<const T*>(buffer + stride * index);
+}
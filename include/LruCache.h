@@ -0,0 +1,423 @@
+// This file defines a least recently
+// used cache built from a doubly
+// linked list of entries and an open
+// addressing hash index into it.
+//
+// The list keeps entries from most to
+// least recently used, and the index
+// maps each key straight to its node,
+// so lookups, promotion to the front
+// and eviction from the back are all
+// O(1). Entries are evicted when the
+// cache holds too many of them or too
+// many bytes.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "DoubleLinkedList.h"
+
+namespace linkedlist {
+
+	//Hit and miss counters of a cache
+	struct CacheCounters {
+		unsigned long long hits = 0;
+		unsigned long long misses = 0;
+		unsigned long long insertions = 0;
+		unsigned long long evictions = 0;
+	};
+
+	std::ostream& operator<<(std::ostream& outStream, const CacheCounters& counters);
+
+	//LruCache class
+	template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename StoragePolicy = policy::HeapStorage, typename ThreadPolicy = policy::SingleThreaded>
+	class LruCache {
+
+		public:
+			//One cached value, with the byte cost it was inserted with
+			struct Entry {
+				K key;
+				V value;
+				std::size_t bytes;
+			};
+
+			typedef doublelink::DataNode<Entry> Node;
+			typedef std::function<void(const K& key, V& value)> EvictionCallback;
+
+		private:
+			//Empty slots have a null node. The full hash is kept to skip most key compares.
+			struct IndexSlot {
+				std::size_t hash;
+				Node* node;
+			};
+
+			doublelink::List<Entry, StoragePolicy> entries;
+			std::vector<IndexSlot> index;
+			std::size_t indexMask;
+
+			std::size_t maxEntries;
+			std::size_t maxBytes;
+			std::size_t bytesInUse;
+
+			[[no_unique_address]] Hash hasher;
+			[[no_unique_address]] KeyEqual keyEqual;
+			[[no_unique_address]] ThreadPolicy threadPolicy;
+
+			EvictionCallback onEviction;
+			CacheCounters counters;
+
+			std::size_t hashOf(const K& key);
+			std::size_t findSlot(const K& key, std::size_t hash);
+			void insertSlot(std::size_t hash, Node* node);
+			void eraseSlot(std::size_t slot);
+			void growIndex();
+			void evictOverflow();
+			void removeNode(Node* node, bool evicted);
+
+		public:
+			LruCache(std::size_t entryCapacity, std::size_t byteCapacity = 0);
+			LruCache(const LruCache& other) = delete;
+
+			V* get(const K& key);
+			V* peek(const K& key);
+			bool contains(const K& key);
+			void put(const K& key, V value, std::size_t bytes = sizeof(K) + sizeof(V));
+			bool erase(const K& key);
+			void clear();
+
+			void setEvictionCallback(EvictionCallback callback);
+			void setCapacity(std::size_t entryCapacity, std::size_t byteCapacity = 0);
+
+			int getSize();
+			std::size_t getCapacity();
+			std::size_t getBytes();
+			std::size_t getMaxBytes();
+			CacheCounters getCounters();
+			void resetCounters();
+			memory::MemoryUsage memoryUsage();
+
+			typename doublelink::List<Entry, StoragePolicy>::Iterator begin();
+			typename doublelink::List<Entry, StoragePolicy>::Iterator end();
+
+			//Overloaded operators
+			LruCache& operator=(const LruCache& other) = delete;
+
+	};
+
+}
+
+/**********************************************************************************************************/
+//                                 Cache Counters                                                         //
+/**********************************************************************************************************/
+
+inline std::ostream& linkedlist::operator<<(std::ostream& outStream, const CacheCounters& counters) {
+	unsigned long long lookups = counters.hits + counters.misses;
+
+	outStream << "hits=" << counters.hits
+		<< " misses=" << counters.misses
+		<< " hitRate=" << (lookups == 0 ? 0.0 : (double)counters.hits / (double)lookups)
+		<< " insertions=" << counters.insertions
+		<< " evictions=" << counters.evictions;
+
+	return outStream;
+}
+
+/**********************************************************************************************************/
+//                                 LRU Cache                                                              //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+//A capacity of 0 leaves that limit off
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::LruCache(std::size_t entryCapacity, std::size_t byteCapacity) {
+	std::size_t slots = 16;
+
+	while (entryCapacity > 0 && slots < 2 * entryCapacity && slots < ((std::size_t)1 << 20)) {
+		slots *= 2;
+	}
+
+	index.assign(slots, IndexSlot{ 0, nullptr });
+	indexMask = slots - 1;
+
+	maxEntries = entryCapacity;
+	maxBytes = byteCapacity;
+	bytesInUse = 0;
+}
+
+//-------Methods-------//
+
+//Spreads the hash over the low bits, std::hash of an integer is often the integer itself
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline std::size_t linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::hashOf(const K& key) {
+	std::uint64_t mixed = (std::uint64_t)hasher(key);
+
+	mixed ^= mixed >> 33;
+	mixed *= 0xff51afd7ed558ccdULL;
+	mixed ^= mixed >> 33;
+
+	return (std::size_t)mixed;
+}
+
+//Linear probe for key, returns the slot holding it or the empty slot that ends the run
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+std::size_t linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::findSlot(const K& key, std::size_t hash) {
+	std::size_t slot = hash & indexMask;
+
+	while (index[slot].node != nullptr) {
+		if (index[slot].hash == hash && keyEqual(index[slot].node->getValue().key, key)) {
+			return slot;
+		}
+
+		slot = (slot + 1) & indexMask;
+	}
+
+	return slot;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::insertSlot(std::size_t hash, Node* node) {
+	std::size_t slot = hash & indexMask;
+
+	while (index[slot].node != nullptr) {
+		slot = (slot + 1) & indexMask;
+	}
+
+	index[slot] = IndexSlot{ hash, node };
+}
+
+//Backward shift deletion: later slots of the probe run move up, so no tombstones are needed
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::eraseSlot(std::size_t slot) {
+	std::size_t nextSlot = slot;
+
+	while (true) {
+		nextSlot = (nextSlot + 1) & indexMask;
+
+		if (index[nextSlot].node == nullptr) {
+			break;
+		}
+
+		std::size_t homeSlot = index[nextSlot].hash & indexMask;
+		bool canMove = nextSlot > slot ? (homeSlot <= slot || homeSlot > nextSlot) : (homeSlot <= slot && homeSlot > nextSlot);
+
+		if (canMove) {
+			index[slot] = index[nextSlot];
+			slot = nextSlot;
+		}
+	}
+
+	index[slot] = IndexSlot{ 0, nullptr };
+}
+
+//Keeps the index at most half full
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::growIndex() {
+	std::vector<IndexSlot> oldIndex(index.size() * 2, IndexSlot{ 0, nullptr });
+
+	oldIndex.swap(index);
+	indexMask = index.size() - 1;
+
+	for (const IndexSlot& slot : oldIndex) {
+		if (slot.node != nullptr) {
+			insertSlot(slot.hash, slot.node);
+		}
+	}
+}
+
+//Drops least recently used entries until both limits hold
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::evictOverflow() {
+	while (entries.getSize() > 0 && ((maxEntries > 0 && (std::size_t)entries.getSize() > maxEntries) || (maxBytes > 0 && bytesInUse > maxBytes))) {
+		removeNode(entries.getListTail(), true);
+	}
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::removeNode(Node* node, bool evicted) {
+	Entry& entry = node->getValue();
+
+	eraseSlot(findSlot(entry.key, hashOf(entry.key)));
+	bytesInUse -= entry.bytes;
+
+	if (evicted) {
+		counters.evictions += 1;
+
+		if (onEviction) {
+			onEviction(entry.key, entry.value);
+		}
+	}
+
+	entries.erase(typename doublelink::List<Entry, StoragePolicy>::Iterator(node));
+}
+
+//Counts a hit or a miss and makes a hit the most recently used entry
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+V* linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::get(const K& key) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	Node* node = index[findSlot(key, hashOf(key))].node;
+
+	if (node == nullptr) {
+		counters.misses += 1;
+		return nullptr;
+	}
+
+	counters.hits += 1;
+	entries.moveToFront(node);
+
+	return &node->getValue().value;
+}
+
+//Looks key up without touching recency or the counters
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+V* linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::peek(const K& key) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	Node* node = index[findSlot(key, hashOf(key))].node;
+
+	return node == nullptr ? nullptr : &node->getValue().value;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+bool linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::contains(const K& key) {
+	return peek(key) != nullptr;
+}
+
+//Inserts or replaces key as the most recently used entry, then evicts down to the limits.
+//An entry larger than the byte limit on its own is evicted straight away.
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::put(const K& key, V value, std::size_t bytes) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	std::size_t hash = hashOf(key);
+	std::size_t slot = findSlot(key, hash);
+	Node* node = index[slot].node;
+
+	if (node != nullptr) {
+		Entry& entry = node->getValue();
+
+		bytesInUse = bytesInUse - entry.bytes + bytes;
+		entry.value = std::move(value);
+		entry.bytes = bytes;
+		entries.moveToFront(node);
+	} else {
+		//Make room first so a full cache never grows its index
+		if (maxEntries > 0 && (std::size_t)entries.getSize() >= maxEntries) {
+			removeNode(entries.getListTail(), true);
+			slot = findSlot(key, hash);
+		}
+
+		entries.emplace_front(Entry{ key, std::move(value), bytes });
+		node = entries.getListHead();
+		bytesInUse += bytes;
+		counters.insertions += 1;
+
+		if ((std::size_t)entries.getSize() * 2 > index.size()) {
+			growIndex();
+			insertSlot(hash, node);
+		} else {
+			index[slot] = IndexSlot{ hash, node };
+		}
+	}
+
+	evictOverflow();
+}
+
+//Removes key without counting an eviction or calling the callback
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+bool linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::erase(const K& key) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	Node* node = index[findSlot(key, hashOf(key))].node;
+
+	if (node == nullptr) {
+		return false;
+	}
+
+	removeNode(node, false);
+
+	return true;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	entries.clear();
+	index.assign(index.size(), IndexSlot{ 0, nullptr });
+	bytesInUse = 0;
+}
+
+//Called with each entry dropped to respect the limits, before it is destroyed
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::setEvictionCallback(EvictionCallback callback) {
+	onEviction = std::move(callback);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::setCapacity(std::size_t entryCapacity, std::size_t byteCapacity) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	maxEntries = entryCapacity;
+	maxBytes = byteCapacity;
+
+	evictOverflow();
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline int linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::getSize() {
+	return entries.getSize();
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline std::size_t linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::getCapacity() {
+	return maxEntries;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline std::size_t linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::getBytes() {
+	return bytesInUse;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline std::size_t linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::getMaxBytes() {
+	return maxBytes;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline linkedlist::CacheCounters linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::getCounters() {
+	return counters;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+void linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::resetCounters() {
+	counters = CacheCounters();
+}
+
+//The entry list plus the hash index
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+linkedlist::memory::MemoryUsage linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::memoryUsage() {
+	memory::MemoryUsage usage = entries.memoryUsage();
+
+	usage.objectBytes = sizeof(LruCache);
+	usage.indexBytes = index.capacity() * sizeof(IndexSlot);
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+//From the most to the least recently used entry
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline typename linkedlist::doublelink::List<typename linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::Entry, StoragePolicy>::Iterator linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::begin() {
+	return entries.begin();
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename StoragePolicy, typename ThreadPolicy>
+inline typename linkedlist::doublelink::List<typename linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::Entry, StoragePolicy>::Iterator linkedlist::LruCache<K, V, Hash, KeyEqual, StoragePolicy, ThreadPolicy>::end() {
+	return entries.end();
+}
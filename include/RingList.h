@@ -0,0 +1,442 @@
+// This file defines the ring list,
+// a fixed capacity singly linked list
+// whose tail links back to its head.
+//
+// Pushing into a full ring overwrites
+// the oldest element in place, so a
+// rolling window of the last N values
+// stops allocating once the ring has
+// filled up once. The oldest and the
+// newest element are always one
+// pointer away.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include "LinkedList.h"
+
+namespace linkedlist {
+
+	namespace singlelink {
+
+		//RingList class
+		template <typename T, typename StoragePolicy = policy::HeapStorage, typename ThreadPolicy = policy::SingleThreaded, typename CheckPolicy = policy::ExitOnOutOfRange>
+		class RingList {
+
+			private:
+				int size;
+				int capacity;
+				//Nodes in the ring, including the spare ones left behind by popFront
+				int allocated;
+
+				//Oldest and newest element. The spare nodes follow listTail.
+				DataNode<T>* listHead;
+				DataNode<T>* listTail;
+
+				[[no_unique_address]] StoragePolicy storage;
+				[[no_unique_address]] ThreadPolicy threadPolicy;
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats listStats;
+#endif
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+				static memory::MemoryUsage reportUsage(void* list);
+#endif
+
+				template <typename Value>
+				void pushValue(Value&& newValue);
+				void freeNodes();
+
+			public:
+				//RingList iterator, from the oldest to the newest element
+				class Iterator {
+
+					private:
+						DataNode<T>* currentNode;
+						int position;
+
+					public:
+						using value_type = T;
+						using reference = T&;
+						using pointer = T*;
+						using difference_type = std::ptrdiff_t;
+						using iterator_category = std::forward_iterator_tag;
+
+						Iterator(DataNode<T>* node, int nodePosition);
+
+						T& operator*() const;
+						T* operator->() const;
+						Iterator& operator++();
+						bool operator==(const Iterator& other) const;
+						bool operator!=(const Iterator& other) const;
+
+				};
+
+				RingList(int ringCapacity);
+				RingList(const RingList& other);
+				RingList(RingList&& other) noexcept;
+				~RingList();
+
+				void push(const T& newValue);
+				void push(T&& newValue);
+				T popFront();
+				void clear();
+
+				T& getOldest();
+				T& getNewest();
+				int getSize();
+				int getCapacity();
+				bool isFull();
+				DataNode<T>* getListHead();
+				DataNode<T>* getListTail();
+				memory::MemoryUsage memoryUsage();
+
+				Iterator begin();
+				Iterator end();
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats getStats();
+#endif
+
+				//Overloaded operators
+				DataNode<T>& operator[](LINKEDLIST_INDEX_TYPE index);
+				RingList& operator=(const RingList& other);
+				RingList& operator=(RingList&& other) noexcept;
+
+				friend std::ostream& operator<<(std::ostream& outStream, RingList& list) {
+					for (T& value : list) {
+						outStream << value << ' ';
+					}
+
+					return outStream;
+				}
+
+		};
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Ring List Iterator                                                     //
+/**********************************************************************************************************/
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::Iterator(DataNode<T>* node, int nodePosition) {
+	currentNode = node;
+	position = nodePosition;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator*() const {
+	return currentNode->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator->() const {
+	return &currentNode->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator& linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator++() {
+	currentNode = currentNode->getNextNode();
+	position += 1;
+
+	return *this;
+}
+
+//The ring never reaches nullptr, so iterators are compared by position
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator==(const Iterator& other) const {
+	return position == other.position;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator!=(const Iterator& other) const {
+	return position != other.position;
+}
+
+/**********************************************************************************************************/
+//                                 Ring List                                                              //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+//Nodes are allocated by the first ringCapacity pushes and reused afterwards
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::RingList(int ringCapacity) {
+	if (ringCapacity <= 0) {
+		exit(139);
+	}
+
+	size = 0;
+	capacity = ringCapacity;
+	allocated = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(RingList).name(), &RingList::reportUsage));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::RingList(const RingList& other) : RingList(other.capacity) {
+	DataNode<T>* sourceNode = other.listHead;
+
+	for (int i = 0; i < other.size; i++) {
+		push(sourceNode->getValue());
+		sourceNode = sourceNode->getNextNode();
+	}
+}
+
+//Takes over the ring of other, leaving it empty with the same capacity
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::RingList(RingList&& other) noexcept : storage(std::move(other.storage)) {
+	size = other.size;
+	capacity = other.capacity;
+	allocated = other.allocated;
+	listHead = other.listHead;
+	listTail = other.listTail;
+	LINKEDLIST_STATS(listStats = other.listStats);
+
+	other.size = 0;
+	other.allocated = 0;
+	other.listHead = nullptr;
+	other.listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(RingList).name(), &RingList::reportUsage));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::~RingList() {
+	LINKEDLIST_REGISTRY(memory::unregisterList(this));
+
+	freeNodes();
+}
+
+/*-------Methods-------*/
+
+//Fills a spare node if there is one, grows the ring until it reaches capacity,
+//then overwrites the oldest element and moves the head on
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename Value>
+void linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::pushValue(Value&& newValue) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	if (size < allocated) {
+		listTail = listTail->getNextNode();
+		listTail->setValue(std::forward<Value>(newValue));
+
+		if (size == 0) {
+			listHead = listTail;
+		}
+
+		size += 1;
+	} else if (allocated < capacity) {
+		DataNode<T>* newNode = storage.template allocate<DataNode<T>>(std::forward<Value>(newValue));
+		LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+		if (listTail == nullptr) {
+			newNode->setNextNode(newNode);
+			listHead = newNode;
+		} else {
+			newNode->setNextNode(listTail->getNextNode());
+			listTail->setNextNode(newNode);
+		}
+
+		listTail = newNode;
+		allocated += 1;
+		size += 1;
+	} else {
+		listHead->setValue(std::forward<Value>(newValue));
+		listTail = listHead;
+		listHead = listHead->getNextNode();
+	}
+
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::freeNodes() {
+	DataNode<T>* currentNode = listHead;
+
+	for (int i = 0; i < allocated; i++) {
+		DataNode<T>* nextNode = currentNode->getNextNode();
+
+		storage.deallocate(currentNode);
+		LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+
+		currentNode = nextNode;
+	}
+
+	size = 0;
+	allocated = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push(const T& newValue) {
+	pushValue(newValue);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push(T&& newValue) {
+	pushValue(std::move(newValue));
+}
+
+//Removes the oldest element. Its node stays in the ring as a spare for the next push.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+T linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::popFront() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(size > 0 ? listHead : nullptr);
+
+	T oldestValue = std::move(listHead->getValue());
+
+	listHead = listHead->getNextNode();
+	size -= 1;
+
+	return oldestValue;
+}
+
+//Empties the window but keeps every node for reuse
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	if (listTail != nullptr) {
+		listHead = listTail->getNextNode();
+	}
+
+	size = 0;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getOldest() {
+	CheckPolicy::checkNode(size > 0 ? listHead : nullptr);
+
+	return listHead->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getNewest() {
+	CheckPolicy::checkNode(size > 0 ? listTail : nullptr);
+
+	return listTail->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline int linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getSize() {
+	return size;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline int linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getCapacity() {
+	return capacity;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::isFull() {
+	return size == capacity;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getListHead() {
+	return size > 0 ? listHead : nullptr;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getListTail() {
+	return size > 0 ? listTail : nullptr;
+}
+
+//Spare nodes are counted, they are part of the ring's footprint
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::memoryUsage() {
+	memory::MemoryUsage usage = memory::nodeUsage(allocated, sizeof(DataNode<T>), 2 * sizeof(DataNode<T>*), sizeof(T), sizeof(RingList));
+
+	usage.elements = size;
+	usage.allocatorSlackBytes = storage.slackBytes(allocated, sizeof(DataNode<T>));
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::begin() {
+	return Iterator(listHead, 0);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::end() {
+	return Iterator(nullptr, size);
+}
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::reportUsage(void* list) {
+	return static_cast<RingList*>(list)->memoryUsage();
+}
+#endif
+
+#ifdef LINKEDLIST_ENABLE_STATS
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::stats::ListStats linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getStats() {
+	return listStats;
+}
+#endif
+
+//-------Operators-------//
+
+//Index 0 is the oldest element
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::DataNode<T>& linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator[](LINKEDLIST_INDEX_TYPE index) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	int hops = index > 0 ? (int)index : 0;
+	DataNode<T>* currentNode = listHead;
+
+	LINKEDLIST_STATS(stats::recordIndex(listStats, hops));
+	LINKEDLIST_PROFILE(profiler::recordTraversal(index.location, hops));
+
+	CheckPolicy::checkNode(hops < size ? currentNode : nullptr);
+
+	for (int i = 0; i < hops; i++) {
+		currentNode = currentNode->getNextNode();
+	}
+
+	return *currentNode;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(const RingList& other) {
+	if (this != &other) {
+		RingList copy(other);
+
+		*this = std::move(copy);
+	}
+
+	return *this;
+}
+
+//Swaps contents with other, which then owns the nodes this ring held before
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::singlelink::RingList<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(RingList&& other) noexcept {
+	if (this != &other) {
+		std::swap(size, other.size);
+		std::swap(capacity, other.capacity);
+		std::swap(allocated, other.allocated);
+		std::swap(listHead, other.listHead);
+		std::swap(listTail, other.listTail);
+		std::swap(storage, other.storage);
+		LINKEDLIST_STATS(std::swap(listStats, other.listStats));
+	}
+
+	return *this;
+}
@@ -0,0 +1,668 @@
+// This file defines the sorted list,
+// a singly linked list that keeps its
+// values ordered under a comparator.
+//
+// The DataNode chain is indexed by up
+// to MAX_LANES express lanes. Every
+// node is promoted to the next lane
+// with probability 1/4, so insert,
+// erase and the bound searches skip
+// most of the chain and take O(log n)
+// expected hops. A pre-sorted batch
+// is merged in a single pass, after
+// which the lanes are rebuilt.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <utility>
+#include "LinkedList.h"
+
+namespace linkedlist {
+
+	namespace singlelink {
+
+		//SortedList class
+		template <typename T, typename Compare = std::less<T>, typename StoragePolicy = policy::HeapStorage, typename ThreadPolicy = policy::SingleThreaded, typename CheckPolicy = policy::ExitOnOutOfRange>
+		class SortedList {
+
+			public:
+				static constexpr int MAX_LANES = 16;
+
+			private:
+				//Express lane entry. Lane 0 points into the DataNode chain,
+				//every higher lane points down to the entry below it.
+				struct LaneNode {
+					DataNode<T>* dataNode;
+					LaneNode* nextLane;
+					LaneNode* downLane;
+
+					LaneNode(DataNode<T>* node, LaneNode* next, LaneNode* down);
+				};
+
+				int size;
+				int laneCount;
+				int laneNodes;
+				std::uint32_t laneSeed;
+
+				DataNode<T>* listHead;
+				DataNode<T>* listTail;
+				LaneNode* laneHeads[MAX_LANES];
+
+				[[no_unique_address]] Compare compare;
+				[[no_unique_address]] StoragePolicy storage;
+				//Lane nodes differ in size from data nodes, so they get a storage of their own
+				[[no_unique_address]] StoragePolicy laneStorage;
+				[[no_unique_address]] ThreadPolicy threadPolicy;
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats listStats;
+#endif
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+				static memory::MemoryUsage reportUsage(void* list);
+#endif
+
+				template <typename Passes>
+				DataNode<T>* findPredecessor(const T& searchValue, Passes passes, LaneNode** lanePredecessors, int& hops);
+				template <typename Value>
+				DataNode<T>* insertValue(Value&& newValue);
+				int randomLanes();
+				void linkLanes(DataNode<T>* node, LaneNode** lanePredecessors, int lanes);
+				void rebuildLanes();
+				void freeLanes();
+
+			public:
+				typedef NodeIterator<DataNode<T>> Iterator;
+
+				SortedList();
+				explicit SortedList(const Compare& comparator);
+				SortedList(const SortedList& other);
+				SortedList(SortedList&& other) noexcept;
+				~SortedList();
+
+				DataNode<T>* insert(const T& newValue);
+				DataNode<T>* insert(T&& newValue);
+				template <typename InputIt>
+				void insert_range(InputIt first, InputIt last);
+				bool erase(const T& eraseValue);
+				void clear();
+
+				Iterator lower_bound(const T& searchValue);
+				Iterator upper_bound(const T& searchValue);
+				DataNode<T>* find(const T& searchValue);
+				bool contains(const T& searchValue);
+
+				T& front();
+				T& back();
+				int getSize();
+				int getLaneCount();
+				DataNode<T>* getListHead();
+				DataNode<T>* getListTail();
+				memory::MemoryUsage memoryUsage();
+
+				Iterator begin();
+				Iterator end();
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats getStats();
+#endif
+
+				//Overloaded operators
+				DataNode<T>& operator[](LINKEDLIST_INDEX_TYPE index);
+				SortedList& operator=(const SortedList& other);
+				SortedList& operator=(SortedList&& other) noexcept;
+
+				friend std::ostream& operator<<(std::ostream& outStream, SortedList& list) {
+					for (T& value : list) {
+						outStream << value << ' ';
+					}
+
+					return outStream;
+				}
+
+		};
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Sorted List Lanes                                                      //
+/**********************************************************************************************************/
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::LaneNode::LaneNode(DataNode<T>* node, LaneNode* next, LaneNode* down) {
+	dataNode = node;
+	nextLane = next;
+	downLane = down;
+}
+
+//Walks the lanes from the top, then the chain, past every value for which passes holds.
+//Returns the last node passed (nullptr when that is none) and, per lane, the last lane
+//node passed in lanePredecessors.
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename Passes>
+linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::findPredecessor(const T& searchValue, Passes passes, LaneNode** lanePredecessors, int& hops) {
+	LaneNode* laneNode = nullptr;
+
+	for (int lane = laneCount - 1; lane >= 0; lane--) {
+		LaneNode* nextLane = laneNode == nullptr ? laneHeads[lane] : laneNode->nextLane;
+
+		while (nextLane != nullptr && passes(nextLane->dataNode->getValue(), searchValue)) {
+			laneNode = nextLane;
+			nextLane = nextLane->nextLane;
+			hops += 1;
+		}
+
+		if (lanePredecessors != nullptr) {
+			lanePredecessors[lane] = laneNode;
+		}
+
+		if (lane > 0 && laneNode != nullptr) {
+			laneNode = laneNode->downLane;
+		}
+	}
+
+	DataNode<T>* previous = laneNode == nullptr ? nullptr : laneNode->dataNode;
+	DataNode<T>* currentNode = previous == nullptr ? listHead : previous->getNextNode();
+
+	while (currentNode != nullptr && passes(currentNode->getValue(), searchValue)) {
+		previous = currentNode;
+		currentNode = currentNode->getNextNode();
+		hops += 1;
+	}
+
+	return previous;
+}
+
+//Geometric with p = 1/4, two random bits per lane
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+int linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::randomLanes() {
+	laneSeed ^= laneSeed << 13;
+	laneSeed ^= laneSeed >> 17;
+	laneSeed ^= laneSeed << 5;
+
+	std::uint32_t bits = laneSeed;
+	int lanes = 0;
+
+	while (lanes < MAX_LANES && (bits & 3) == 0) {
+		lanes += 1;
+		bits >>= 2;
+	}
+
+	return lanes;
+}
+
+//Links node into the bottom `lanes` lanes after lanePredecessors, which are then
+//advanced to the new lane nodes
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::linkLanes(DataNode<T>* node, LaneNode** lanePredecessors, int lanes) {
+	LaneNode* belowLane = nullptr;
+
+	for (int lane = 0; lane < lanes; lane++) {
+		LaneNode*& link = lanePredecessors[lane] == nullptr ? laneHeads[lane] : lanePredecessors[lane]->nextLane;
+		LaneNode* laneNode = laneStorage.template allocate<LaneNode>(node, link, belowLane);
+		LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(LaneNode)));
+
+		link = laneNode;
+		lanePredecessors[lane] = laneNode;
+		belowLane = laneNode;
+	}
+
+	if (lanes > laneCount) {
+		laneCount = lanes;
+	}
+
+	laneNodes += lanes;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::rebuildLanes() {
+	LaneNode* laneTails[MAX_LANES] = {};
+
+	freeLanes();
+
+	for (DataNode<T>* currentNode = listHead; currentNode != nullptr; currentNode = currentNode->getNextNode()) {
+		linkLanes(currentNode, laneTails, randomLanes());
+	}
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::freeLanes() {
+	for (int lane = 0; lane < MAX_LANES; lane++) {
+		LaneNode* laneNode = laneHeads[lane];
+
+		while (laneNode != nullptr) {
+			LaneNode* nextLane = laneNode->nextLane;
+
+			laneStorage.deallocate(laneNode);
+			LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(LaneNode)));
+
+			laneNode = nextLane;
+		}
+
+		laneHeads[lane] = nullptr;
+	}
+
+	laneCount = 0;
+	laneNodes = 0;
+}
+
+/**********************************************************************************************************/
+//                                 Sorted List                                                            //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::SortedList() : SortedList(Compare()) {
+
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::SortedList(const Compare& comparator) : compare(comparator) {
+	size = 0;
+	laneCount = 0;
+	laneNodes = 0;
+	laneSeed = 0x9E3779B9u;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	for (int lane = 0; lane < MAX_LANES; lane++) {
+		laneHeads[lane] = nullptr;
+	}
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(SortedList).name(), &SortedList::reportUsage));
+}
+
+//Other is already sorted, so the copy is a single merge into an empty list
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::SortedList(const SortedList& other) : SortedList(other.compare) {
+	insert_range(Iterator(other.listHead), Iterator(nullptr));
+}
+
+//Takes over the nodes and lanes of other, leaving it empty
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::SortedList(SortedList&& other) noexcept : compare(other.compare), storage(std::move(other.storage)), laneStorage(std::move(other.laneStorage)) {
+	size = other.size;
+	laneCount = other.laneCount;
+	laneNodes = other.laneNodes;
+	laneSeed = other.laneSeed;
+	listHead = other.listHead;
+	listTail = other.listTail;
+	LINKEDLIST_STATS(listStats = other.listStats);
+
+	for (int lane = 0; lane < MAX_LANES; lane++) {
+		laneHeads[lane] = other.laneHeads[lane];
+		other.laneHeads[lane] = nullptr;
+	}
+
+	other.size = 0;
+	other.laneCount = 0;
+	other.laneNodes = 0;
+	other.listHead = nullptr;
+	other.listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(SortedList).name(), &SortedList::reportUsage));
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::~SortedList() {
+	LINKEDLIST_REGISTRY(memory::unregisterList(this));
+
+	clear();
+}
+
+/*-------Methods-------*/
+
+//Equal values keep their insertion order, the new one goes after them
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename Value>
+linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::insertValue(Value&& newValue) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	LaneNode* lanePredecessors[MAX_LANES] = {};
+	int hops = 0;
+
+	DataNode<T>* newNode = storage.template allocate<DataNode<T>>(std::forward<Value>(newValue));
+	LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+	Compare& comparator = compare;
+	DataNode<T>* previous = findPredecessor(newNode->getValue(), [&comparator](const T& nodeValue, const T& searchValue) { return !comparator(searchValue, nodeValue); }, lanePredecessors, hops);
+
+	if (previous == nullptr) {
+		newNode->setNextNode(listHead);
+		listHead = newNode;
+	} else {
+		newNode->setNextNode(previous->getNextNode());
+		previous->setNextNode(newNode);
+	}
+
+	if (newNode->getNextNode() == nullptr) {
+		listTail = newNode;
+	}
+
+	size += 1;
+	linkLanes(newNode, lanePredecessors, randomLanes());
+	LINKEDLIST_STATS(stats::recordAppend(listStats, hops));
+
+	return newNode;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::insert(const T& newValue) {
+	return insertValue(newValue);
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::insert(T&& newValue) {
+	return insertValue(std::move(newValue));
+}
+
+//Merges a batch that is already sorted under the list's comparator in one walk of the
+//chain, then rebuilds the lanes in a second. An unsorted batch is caught by CheckPolicy.
+//The batch is first copied into a detached chain, so [first, last) may range over this list.
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename InputIt>
+void linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::insert_range(InputIt first, InputIt last) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	LINKEDLIST_TRACE(trace::Span span("SortedList::insert_range", 0, 0));
+	DataNode<T>* batchHead = nullptr;
+	DataNode<T>* batchTail = nullptr;
+	int batchSize = 0;
+
+	for (; first != last; ++first) {
+		DataNode<T>* batchNode = storage.template allocate<DataNode<T>>(*first);
+		LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+		if (batchTail == nullptr) {
+			batchHead = batchNode;
+		} else {
+			CheckPolicy::checkLink(!compare(batchNode->getValue(), batchTail->getValue()));
+			batchTail->setNextNode(batchNode);
+		}
+
+		batchTail = batchNode;
+		batchSize += 1;
+	}
+
+	if (batchHead == nullptr) {
+		return;
+	}
+
+	DataNode<T>* previous = nullptr;
+	DataNode<T>* currentNode = listHead;
+
+	while (batchHead != nullptr) {
+		DataNode<T>* batchNode = batchHead;
+
+		batchHead = batchHead->getNextNode();
+
+		while (currentNode != nullptr && !compare(batchNode->getValue(), currentNode->getValue())) {
+			previous = currentNode;
+			currentNode = currentNode->getNextNode();
+			LINKEDLIST_TRACE(span.addHops(1));
+		}
+
+		batchNode->setNextNode(currentNode);
+
+		if (previous == nullptr) {
+			listHead = batchNode;
+		} else {
+			previous->setNextNode(batchNode);
+		}
+
+		if (currentNode == nullptr) {
+			listTail = batchNode;
+		}
+
+		previous = batchNode;
+	}
+
+	size += batchSize;
+	LINKEDLIST_TRACE(span.setElements(batchSize));
+
+	rebuildLanes();
+}
+
+//Removes the first value equivalent to eraseValue
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+bool linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::erase(const T& eraseValue) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	LaneNode* lanePredecessors[MAX_LANES] = {};
+	int hops = 0;
+
+	DataNode<T>* previous = findPredecessor(eraseValue, compare, lanePredecessors, hops);
+	DataNode<T>* eraseNode = previous == nullptr ? listHead : previous->getNextNode();
+
+	if (eraseNode == nullptr || compare(eraseValue, eraseNode->getValue())) {
+		return false;
+	}
+
+	//A node sits in a contiguous run of lanes starting at lane 0
+	for (int lane = 0; lane < laneCount; lane++) {
+		LaneNode*& link = lanePredecessors[lane] == nullptr ? laneHeads[lane] : lanePredecessors[lane]->nextLane;
+
+		if (link == nullptr || link->dataNode != eraseNode) {
+			break;
+		}
+
+		LaneNode* laneNode = link;
+
+		link = laneNode->nextLane;
+		laneStorage.deallocate(laneNode);
+		LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(LaneNode)));
+		laneNodes -= 1;
+	}
+
+	while (laneCount > 0 && laneHeads[laneCount - 1] == nullptr) {
+		laneCount -= 1;
+	}
+
+	if (previous == nullptr) {
+		listHead = eraseNode->getNextNode();
+	} else {
+		previous->setNextNode(eraseNode->getNextNode());
+	}
+
+	if (listTail == eraseNode) {
+		listTail = previous;
+	}
+
+	storage.deallocate(eraseNode);
+	LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+	size -= 1;
+
+	return true;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* currentNode = listHead;
+
+	freeLanes();
+
+	while (currentNode != nullptr) {
+		DataNode<T>* nextNode = currentNode->getNextNode();
+
+		storage.deallocate(currentNode);
+		LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+
+		currentNode = nextNode;
+	}
+
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+}
+
+//First value not ordered before searchValue
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::lower_bound(const T& searchValue) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	int hops = 0;
+
+	DataNode<T>* previous = findPredecessor(searchValue, compare, nullptr, hops);
+	DataNode<T>* boundNode = previous == nullptr ? listHead : previous->getNextNode();
+	LINKEDLIST_STATS(stats::recordFind(listStats, hops, boundNode != nullptr));
+
+	return Iterator(boundNode);
+}
+
+//First value ordered after searchValue
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::upper_bound(const T& searchValue) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	Compare& comparator = compare;
+	int hops = 0;
+
+	DataNode<T>* previous = findPredecessor(searchValue, [&comparator](const T& nodeValue, const T& boundValue) { return !comparator(boundValue, nodeValue); }, nullptr, hops);
+	DataNode<T>* boundNode = previous == nullptr ? listHead : previous->getNextNode();
+	LINKEDLIST_STATS(stats::recordFind(listStats, hops, boundNode != nullptr));
+
+	return Iterator(boundNode);
+}
+
+//First value equivalent to searchValue, or nullptr
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::find(const T& searchValue) {
+	DataNode<T>* boundNode = lower_bound(searchValue).getNode();
+
+	if (boundNode == nullptr || compare(searchValue, boundNode->getValue())) {
+		return nullptr;
+	}
+
+	return boundNode;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::contains(const T& searchValue) {
+	return find(searchValue) != nullptr;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::front() {
+	CheckPolicy::checkNode(listHead);
+
+	return listHead->getValue();
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::back() {
+	CheckPolicy::checkNode(listTail);
+
+	return listTail->getValue();
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline int linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::getSize() {
+	return size;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline int linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::getLaneCount() {
+	return laneCount;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::getListHead() {
+	return listHead;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::singlelink::DataNode<T>* linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::getListTail() {
+	return listTail;
+}
+
+//The express lanes are reported as index bytes
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::memoryUsage() {
+	memory::MemoryUsage usage = memory::nodeUsage(size, sizeof(DataNode<T>), 2 * sizeof(DataNode<T>*), sizeof(T), sizeof(SortedList));
+
+	usage.indexBytes = laneNodes * sizeof(LaneNode);
+	usage.allocatorSlackBytes = storage.slackBytes(size, sizeof(DataNode<T>)) + laneStorage.slackBytes(laneNodes, sizeof(LaneNode));
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::begin() {
+	return Iterator(listHead);
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::end() {
+	return Iterator(nullptr);
+}
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::reportUsage(void* list) {
+	return static_cast<SortedList*>(list)->memoryUsage();
+}
+#endif
+
+#ifdef LINKEDLIST_ENABLE_STATS
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::stats::ListStats linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::getStats() {
+	return listStats;
+}
+#endif
+
+//-------Operators-------//
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::DataNode<T>& linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::operator[](LINKEDLIST_INDEX_TYPE index) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	int hops = index > 0 ? (int)index : 0;
+	DataNode<T>* currentNode = listHead;
+
+	LINKEDLIST_STATS(stats::recordIndex(listStats, hops));
+	LINKEDLIST_PROFILE(profiler::recordTraversal(index.location, hops));
+
+	CheckPolicy::checkNode(hops < size ? currentNode : nullptr);
+
+	for (int i = 0; i < hops; i++) {
+		currentNode = currentNode->getNextNode();
+	}
+
+	return *currentNode;
+}
+
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(const SortedList& other) {
+	if (this != &other) {
+		SortedList copy(other);
+
+		*this = std::move(copy);
+	}
+
+	return *this;
+}
+
+//Swaps contents with other, which then owns the nodes this list held before
+template <typename T, typename Compare, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::singlelink::SortedList<T, Compare, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(SortedList&& other) noexcept {
+	if (this != &other) {
+		std::swap(size, other.size);
+		std::swap(laneCount, other.laneCount);
+		std::swap(laneNodes, other.laneNodes);
+		std::swap(laneSeed, other.laneSeed);
+		std::swap(listHead, other.listHead);
+		std::swap(listTail, other.listTail);
+		std::swap(laneHeads, other.laneHeads);
+		std::swap(compare, other.compare);
+		std::swap(storage, other.storage);
+		std::swap(laneStorage, other.laneStorage);
+		LINKEDLIST_STATS(std::swap(listStats, other.listStats));
+	}
+
+	return *this;
+}
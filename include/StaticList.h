@@ -0,0 +1,435 @@
+// This file defines a fixed capacity
+// list whose nodes live inline in a
+// std::array and link to each other
+// by index instead of by pointer.
+//
+// Every operation is constexpr, so a
+// table can be built entirely at
+// compile time and stored in read-only
+// data with no construction cost at
+// process start.
+//
+// Removed slots go onto an internal
+// free list and are reused by later
+// inserts, so the list never touches
+// the heap.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include "ListMemory.h"
+
+namespace linkedlist {
+
+	namespace singlelink {
+
+		//Smallest unsigned type able to address Capacity nodes plus the end marker
+		template <std::size_t Capacity>
+		using StaticIndex = typename std::conditional<(Capacity < 0xFF), std::uint8_t,
+			typename std::conditional<(Capacity < 0xFFFF), std::uint16_t, std::uint32_t>::type>::type;
+
+		//StaticNode class
+		template <typename T, typename Index>
+		class StaticNode {
+
+			private:
+				T value;
+				Index nextIndex;
+
+			public:
+				constexpr StaticNode();
+				constexpr StaticNode(T nodeValue, Index nodeNextIndex);
+
+				constexpr void setValue(T nodeValue);
+				constexpr void setNextIndex(Index nodeNextIndex);
+
+				constexpr T& getValue();
+				constexpr T getValue() const;
+				constexpr Index getNextIndex() const;
+
+				//Overloaded operators
+				constexpr void operator=(T newValue);
+
+		};
+
+		//StaticList class
+		template <typename T, std::size_t Capacity>
+		class StaticList {
+
+			public:
+				typedef StaticIndex<Capacity> Index;
+				typedef StaticNode<T, Index> Node;
+
+				static constexpr Index END = (Index)Capacity;
+
+				//StaticList iterator
+				class Iterator {
+
+					private:
+						const StaticList* list;
+						Index position;
+
+					public:
+						constexpr Iterator(const StaticList* iteratedList, Index nodeIndex);
+
+						constexpr T operator*() const;
+						constexpr Iterator& operator++();
+						constexpr bool operator!=(const Iterator& other) const;
+
+				};
+
+			private:
+				std::array<Node, Capacity> nodes;
+				int size;
+				int usedSlots;
+				Index headIndex;
+				Index tailIndex;
+				Index freeIndex;
+
+				constexpr Index allocateSlot(T newValue);
+				constexpr void releaseSlot(Index nodeIndex);
+				constexpr Index walkTo(int index) const;
+
+			public:
+				constexpr StaticList();
+				constexpr StaticList(int length, T padValue);
+
+				constexpr void append(T newValue);
+				constexpr void insert(int index, T newValue);
+				constexpr void remove(int index);
+				constexpr T popFront();
+				constexpr void clear();
+
+				constexpr int getSize() const;
+				constexpr int getCapacity() const;
+				constexpr Index getHeadIndex() const;
+				constexpr Index getTailIndex() const;
+				constexpr const Node& getNode(Index nodeIndex) const;
+				constexpr bool getMultiDim() const;
+				memory::MemoryUsage memoryUsage() const;
+
+				constexpr Iterator begin() const;
+				constexpr Iterator end() const;
+
+				//Overloaded operators
+				constexpr Node& operator[](int index);
+				constexpr const Node& operator[](int index) const;
+
+				friend std::ostream& operator<<(std::ostream& outStream, const StaticList& list) {
+					for (T value : list) {
+						outStream << value << ' ';
+					}
+
+					return outStream;
+				}
+
+		};
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 Static Node                                                            //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T, typename Index>
+constexpr linkedlist::singlelink::StaticNode<T, Index>::StaticNode() : value(), nextIndex(0) {
+
+}
+
+template <typename T, typename Index>
+constexpr linkedlist::singlelink::StaticNode<T, Index>::StaticNode(T nodeValue, Index nodeNextIndex) : value(nodeValue), nextIndex(nodeNextIndex) {
+
+}
+
+//-------Methods-------//
+
+template <typename T, typename Index>
+constexpr void linkedlist::singlelink::StaticNode<T, Index>::setValue(T nodeValue) {
+	value = nodeValue;
+}
+
+template <typename T, typename Index>
+constexpr void linkedlist::singlelink::StaticNode<T, Index>::setNextIndex(Index nodeNextIndex) {
+	nextIndex = nodeNextIndex;
+}
+
+//Lets a value be updated in place, e.g. a member of a struct element
+template <typename T, typename Index>
+constexpr T& linkedlist::singlelink::StaticNode<T, Index>::getValue() {
+	return value;
+}
+
+template <typename T, typename Index>
+constexpr T linkedlist::singlelink::StaticNode<T, Index>::getValue() const {
+	return value;
+}
+
+template <typename T, typename Index>
+constexpr Index linkedlist::singlelink::StaticNode<T, Index>::getNextIndex() const {
+	return nextIndex;
+}
+
+//-------Operators-------//
+
+template <typename T, typename Index>
+constexpr void linkedlist::singlelink::StaticNode<T, Index>::operator=(T newValue) {
+	setValue(newValue);
+}
+
+/**********************************************************************************************************/
+//                                 Static List Iterator                                                   //
+/**********************************************************************************************************/
+
+template <typename T, std::size_t Capacity>
+constexpr linkedlist::singlelink::StaticList<T, Capacity>::Iterator::Iterator(const StaticList* iteratedList, Index nodeIndex) : list(iteratedList), position(nodeIndex) {
+
+}
+
+template <typename T, std::size_t Capacity>
+constexpr T linkedlist::singlelink::StaticList<T, Capacity>::Iterator::operator*() const {
+	return list->getNode(position).getValue();
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename linkedlist::singlelink::StaticList<T, Capacity>::Iterator& linkedlist::singlelink::StaticList<T, Capacity>::Iterator::operator++() {
+	position = list->getNode(position).getNextIndex();
+
+	return *this;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr bool linkedlist::singlelink::StaticList<T, Capacity>::Iterator::operator!=(const Iterator& other) const {
+	return position != other.position;
+}
+
+/**********************************************************************************************************/
+//                                 Static List                                                            //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T, std::size_t Capacity>
+constexpr linkedlist::singlelink::StaticList<T, Capacity>::StaticList() : nodes(), size(0), usedSlots(0), headIndex(END), tailIndex(END), freeIndex(END) {
+
+}
+
+template <typename T, std::size_t Capacity>
+constexpr linkedlist::singlelink::StaticList<T, Capacity>::StaticList(int length, T padValue) : nodes(), size(0), usedSlots(0), headIndex(END), tailIndex(END), freeIndex(END) {
+	for (int i = 0; i < length; i++) {
+		append(padValue);
+	}
+}
+
+//-------Methods-------//
+
+//Reuses a released slot first, then the next never used one
+template <typename T, std::size_t Capacity>
+constexpr typename linkedlist::singlelink::StaticList<T, Capacity>::Index linkedlist::singlelink::StaticList<T, Capacity>::allocateSlot(T newValue) {
+	Index newIndex = END;
+
+	if (freeIndex != END) {
+		newIndex = freeIndex;
+		freeIndex = nodes[freeIndex].getNextIndex();
+	} else if (usedSlots < (int)Capacity) {
+		newIndex = (Index)usedSlots;
+		usedSlots += 1;
+	} else {
+		exit(139);
+	}
+
+	nodes[newIndex] = Node(newValue, END);
+
+	return newIndex;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr void linkedlist::singlelink::StaticList<T, Capacity>::releaseSlot(Index nodeIndex) {
+	nodes[nodeIndex] = Node(T(), freeIndex);
+	freeIndex = nodeIndex;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename linkedlist::singlelink::StaticList<T, Capacity>::Index linkedlist::singlelink::StaticList<T, Capacity>::walkTo(int index) const {
+	Index currentIndex = headIndex;
+
+	for (int i = 0; i < index; i++) {
+		currentIndex = nodes[currentIndex].getNextIndex();
+	}
+
+	return currentIndex;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr void linkedlist::singlelink::StaticList<T, Capacity>::append(T newValue) {
+	Index newIndex = allocateSlot(newValue);
+
+	if (headIndex == END) {
+		headIndex = newIndex;
+	} else {
+		nodes[tailIndex].setNextIndex(newIndex);
+	}
+
+	tailIndex = newIndex;
+	size += 1;
+}
+
+//Inserts before the element at index; index == getSize() appends
+template <typename T, std::size_t Capacity>
+constexpr void linkedlist::singlelink::StaticList<T, Capacity>::insert(int index, T newValue) {
+	if (index < 0 || index > size) {
+		exit(139);
+	}
+
+	if (index == size) {
+		append(newValue);
+		return;
+	}
+
+	Index newIndex = allocateSlot(newValue);
+
+	if (index == 0) {
+		nodes[newIndex].setNextIndex(headIndex);
+		headIndex = newIndex;
+	} else {
+		Index previousIndex = walkTo(index - 1);
+
+		nodes[newIndex].setNextIndex(nodes[previousIndex].getNextIndex());
+		nodes[previousIndex].setNextIndex(newIndex);
+	}
+
+	size += 1;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr void linkedlist::singlelink::StaticList<T, Capacity>::remove(int index) {
+	if (index < 0 || index >= size) {
+		exit(139);
+	}
+
+	Index removedIndex = headIndex;
+
+	if (index == 0) {
+		headIndex = nodes[headIndex].getNextIndex();
+
+		if (headIndex == END) {
+			tailIndex = END;
+		}
+	} else {
+		Index previousIndex = walkTo(index - 1);
+
+		removedIndex = nodes[previousIndex].getNextIndex();
+		nodes[previousIndex].setNextIndex(nodes[removedIndex].getNextIndex());
+
+		if (removedIndex == tailIndex) {
+			tailIndex = previousIndex;
+		}
+	}
+
+	releaseSlot(removedIndex);
+	size -= 1;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr T linkedlist::singlelink::StaticList<T, Capacity>::popFront() {
+	if (size == 0) {
+		exit(139);
+	}
+
+	T frontValue = nodes[headIndex].getValue();
+
+	remove(0);
+
+	return frontValue;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr void linkedlist::singlelink::StaticList<T, Capacity>::clear() {
+	while (size > 0) {
+		remove(0);
+	}
+}
+
+template <typename T, std::size_t Capacity>
+constexpr int linkedlist::singlelink::StaticList<T, Capacity>::getSize() const {
+	return size;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr int linkedlist::singlelink::StaticList<T, Capacity>::getCapacity() const {
+	return (int)Capacity;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename linkedlist::singlelink::StaticList<T, Capacity>::Index linkedlist::singlelink::StaticList<T, Capacity>::getHeadIndex() const {
+	return headIndex;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename linkedlist::singlelink::StaticList<T, Capacity>::Index linkedlist::singlelink::StaticList<T, Capacity>::getTailIndex() const {
+	return tailIndex;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const typename linkedlist::singlelink::StaticList<T, Capacity>::Node& linkedlist::singlelink::StaticList<T, Capacity>::getNode(Index nodeIndex) const {
+	return nodes[nodeIndex];
+}
+
+template <typename T, std::size_t Capacity>
+constexpr bool linkedlist::singlelink::StaticList<T, Capacity>::getMultiDim() const {
+	return false;
+}
+
+//Node storage is inline, so unused slots count as slack rather than as heap
+template <typename T, std::size_t Capacity>
+linkedlist::memory::MemoryUsage linkedlist::singlelink::StaticList<T, Capacity>::memoryUsage() const {
+	memory::MemoryUsage usage;
+
+	usage.elements = size;
+	usage.objectBytes = sizeof(StaticList) - sizeof(nodes);
+	usage.nodeHeaderBytes = size * sizeof(Index);
+	usage.payloadBytes = size * sizeof(T);
+	usage.paddingBytes = size * (sizeof(Node) - sizeof(Index) - sizeof(T));
+	usage.allocatorSlackBytes = (Capacity - size) * sizeof(Node);
+
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename linkedlist::singlelink::StaticList<T, Capacity>::Iterator linkedlist::singlelink::StaticList<T, Capacity>::begin() const {
+	return Iterator(this, headIndex);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename linkedlist::singlelink::StaticList<T, Capacity>::Iterator linkedlist::singlelink::StaticList<T, Capacity>::end() const {
+	return Iterator(this, END);
+}
+
+//-------Operators-------//
+
+template <typename T, std::size_t Capacity>
+constexpr typename linkedlist::singlelink::StaticList<T, Capacity>::Node& linkedlist::singlelink::StaticList<T, Capacity>::operator[](int index) {
+	return const_cast<Node&>(static_cast<const StaticList&>(*this)[index]);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const typename linkedlist::singlelink::StaticList<T, Capacity>::Node& linkedlist::singlelink::StaticList<T, Capacity>::operator[](int index) const {
+	if (index < 0 || index >= size) {
+		exit(139);
+	}
+
+	return nodes[walkTo(index)];
+}
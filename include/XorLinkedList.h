@@ -0,0 +1,682 @@
+// This file defines the XOR linked
+// list, whose nodes store the XOR of
+// the previous and next node address
+// in a single word.
+//
+// A node costs one pointer on top of
+// its value, less than the next and
+// bottom pointers of a singlelink
+// node, but the list can still be
+// walked in both directions. Walking
+// needs the node you came from, so
+// nodes are reached through iterators
+// rather than by pointer alone.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include "LinkedList.h"
+
+namespace linkedlist {
+
+	namespace xorlink {
+
+		//DataNode class
+		template <typename T>
+		class DataNode {
+
+		private:
+			std::uintptr_t link;
+			T value;
+
+		public:
+			DataNode();
+			DataNode(T nodeValue);
+			template <typename... Args>
+			DataNode(std::in_place_t, Args&&... args);
+
+			void setValue(const T& nodeValue);
+			void setValue(T&& nodeValue);
+			void relink(DataNode<T>* oldNeighbour, DataNode<T>* newNeighbour);
+
+			T& getValue();
+			const T& getValue() const;
+			DataNode<T>* getOtherNode(DataNode<T>* fromNode);
+
+			//Overloaded operators
+			void operator=(const T& newValue);
+			void operator=(T&& newValue);
+			friend std::ostream& operator<<(std::ostream& outStream, DataNode<T>& node) {
+				outStream << node.getValue() << ' ';
+
+				return outStream;
+			}
+
+		};
+
+		//List class
+		template <typename T, typename StoragePolicy = policy::HeapStorage, typename ThreadPolicy = policy::SingleThreaded, typename CheckPolicy = policy::ExitOnOutOfRange>
+		class List {
+
+			private:
+				int size;
+
+				DataNode<T>* listHead;
+				DataNode<T>* listTail;
+
+				[[no_unique_address]] StoragePolicy storage;
+				[[no_unique_address]] ThreadPolicy threadPolicy;
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats listStats;
+#endif
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+				static memory::MemoryUsage reportUsage(void* list);
+#endif
+
+				void linkAtEnd(DataNode<T>* newNode, DataNode<T>*& endNode, DataNode<T>*& otherEnd);
+				void unlinkAtEnd(DataNode<T>*& endNode, DataNode<T>*& otherEnd);
+				void appendNodesOf(const List& source);
+
+			public:
+				//XOR list iterator, carries the node it came from to find the next one
+				class Iterator {
+
+					private:
+						DataNode<T>* prevNode;
+						DataNode<T>* currentNode;
+
+					public:
+						using value_type = T;
+						using reference = T&;
+						using pointer = T*;
+						using difference_type = std::ptrdiff_t;
+						using iterator_category = std::bidirectional_iterator_tag;
+
+						Iterator();
+						Iterator(DataNode<T>* fromNode, DataNode<T>* node);
+
+						DataNode<T>* getPrevNode() const;
+						DataNode<T>* getNode() const;
+
+						//Overloaded operators
+						T& operator*() const;
+						T* operator->() const;
+						Iterator& operator++();
+						Iterator operator++(int);
+						Iterator& operator--();
+						Iterator operator--(int);
+						bool operator==(const Iterator& other) const;
+						bool operator!=(const Iterator& other) const;
+
+				};
+
+				List();
+				explicit List(const StoragePolicy& nodeStorage);
+				List(const List& other);
+				List(List&& other) noexcept;
+				~List();
+
+				void push_front(const T& newValue);
+				void push_front(T&& newValue);
+				void push_back(const T& newValue);
+				void push_back(T&& newValue);
+				template <typename... Args>
+				T& emplace_front(Args&&... args);
+				template <typename... Args>
+				T& emplace_back(Args&&... args);
+				void pop_front();
+				void pop_back();
+				Iterator erase(Iterator position);
+				void reverse();
+				void clear();
+
+				T& front();
+				T& back();
+				int getSize();
+				memory::MemoryUsage memoryUsage();
+
+				Iterator begin();
+				Iterator end();
+				Iterator rbegin();
+				Iterator rend();
+
+#ifdef LINKEDLIST_ENABLE_STATS
+				stats::ListStats getStats();
+#endif
+
+				//Overloaded operators
+				DataNode<T>& operator[](LINKEDLIST_INDEX_TYPE index);
+				List& operator=(const List& other);
+				List& operator=(List&& other) noexcept;
+
+				friend std::ostream& operator<<(std::ostream& outStream, List& list) {
+					for (T& value : list) {
+						outStream << value << ' ';
+					}
+
+					return outStream;
+				}
+
+		};
+
+	}
+
+}
+
+/**********************************************************************************************************/
+//                                 XOR Link Data Node                                                     //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T>
+linkedlist::xorlink::DataNode<T>::DataNode() : value() {
+	link = 0;
+}
+
+template <typename T>
+linkedlist::xorlink::DataNode<T>::DataNode(T nodeValue) : value(std::move(nodeValue)) {
+	link = 0;
+}
+
+//Constructs the value in place from args
+template <typename T>
+template <typename... Args>
+linkedlist::xorlink::DataNode<T>::DataNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...) {
+	link = 0;
+}
+
+//-------Methods-------//
+
+template <typename T>
+inline void linkedlist::xorlink::DataNode<T>::setValue(const T& nodeValue) {
+	value = nodeValue;
+}
+
+template <typename T>
+inline void linkedlist::xorlink::DataNode<T>::setValue(T&& nodeValue) {
+	value = std::move(nodeValue);
+}
+
+//Replaces one neighbour with another, either side may be null
+template <typename T>
+inline void linkedlist::xorlink::DataNode<T>::relink(DataNode<T>* oldNeighbour, DataNode<T>* newNeighbour) {
+	link ^= reinterpret_cast<std::uintptr_t>(oldNeighbour) ^ reinterpret_cast<std::uintptr_t>(newNeighbour);
+}
+
+template <typename T>
+inline T& linkedlist::xorlink::DataNode<T>::getValue() {
+	return value;
+}
+
+template <typename T>
+inline const T& linkedlist::xorlink::DataNode<T>::getValue() const {
+	return value;
+}
+
+//The neighbour on the side opposite fromNode
+template <typename T>
+inline linkedlist::xorlink::DataNode<T>* linkedlist::xorlink::DataNode<T>::getOtherNode(DataNode<T>* fromNode) {
+	return reinterpret_cast<DataNode<T>*>(link ^ reinterpret_cast<std::uintptr_t>(fromNode));
+}
+
+//-------Operators-------//
+
+template <typename T>
+inline void linkedlist::xorlink::DataNode<T>::operator=(const T& newValue) {
+	setValue(newValue);
+}
+
+template <typename T>
+inline void linkedlist::xorlink::DataNode<T>::operator=(T&& newValue) {
+	setValue(std::move(newValue));
+}
+
+/**********************************************************************************************************/
+//                                 XOR Link List Iterator                                                 //
+/**********************************************************************************************************/
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::Iterator() {
+	prevNode = nullptr;
+	currentNode = nullptr;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::Iterator(DataNode<T>* fromNode, DataNode<T>* node) {
+	prevNode = fromNode;
+	currentNode = node;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::xorlink::DataNode<T>* linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::getPrevNode() const {
+	return prevNode;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline linkedlist::xorlink::DataNode<T>* linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::getNode() const {
+	return currentNode;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator*() const {
+	return currentNode->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T* linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator->() const {
+	return &currentNode->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator++() {
+	DataNode<T>* nextNode = currentNode->getOtherNode(prevNode);
+
+	prevNode = currentNode;
+	currentNode = nextNode;
+
+	return *this;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator++(int) {
+	Iterator previous = *this;
+
+	++(*this);
+
+	return previous;
+}
+
+//Steps back onto prevNode, whose own predecessor is recovered from its link
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator--() {
+	DataNode<T>* beforeNode = prevNode->getOtherNode(currentNode);
+
+	currentNode = prevNode;
+	prevNode = beforeNode;
+
+	return *this;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator--(int) {
+	Iterator previous = *this;
+
+	--(*this);
+
+	return previous;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator==(const Iterator& other) const {
+	return currentNode == other.currentNode;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline bool linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator::operator!=(const Iterator& other) const {
+	return currentNode != other.currentNode;
+}
+
+/**********************************************************************************************************/
+//                                 XOR Link List Controller                                               //
+/**********************************************************************************************************/
+
+//-------Constructors-------//
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::List() {
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//Allocates nodes from nodeStorage, e.g. a pool shared with other lists
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::List(const StoragePolicy& nodeStorage) : storage(nodeStorage) {
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::List(const List& other) {
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+
+	appendNodesOf(other);
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+//Takes over the nodes of other, leaving it empty
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::List(List&& other) noexcept : storage(std::move(other.storage)) {
+	size = other.size;
+	listHead = other.listHead;
+	listTail = other.listTail;
+	LINKEDLIST_STATS(listStats = other.listStats);
+
+	other.size = 0;
+	other.listHead = nullptr;
+	other.listTail = nullptr;
+
+	LINKEDLIST_REGISTRY(memory::registerList(this, typeid(List).name(), &List::reportUsage));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::~List() {
+	LINKEDLIST_REGISTRY(memory::unregisterList(this));
+
+	clear();
+}
+
+/*-------Methods-------*/
+
+//The list is symmetric, so both ends are handled by the same code with the roles of head and tail swapped
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::linkAtEnd(DataNode<T>* newNode, DataNode<T>*& endNode, DataNode<T>*& otherEnd) {
+	newNode->relink(nullptr, endNode);
+
+	if (endNode == nullptr) {
+		otherEnd = newNode;
+	} else {
+		endNode->relink(nullptr, newNode);
+	}
+
+	endNode = newNode;
+	size += 1;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::unlinkAtEnd(DataNode<T>*& endNode, DataNode<T>*& otherEnd) {
+	DataNode<T>* oldNode = endNode;
+	DataNode<T>* innerNode = oldNode->getOtherNode(nullptr);
+
+	if (innerNode == nullptr) {
+		otherEnd = nullptr;
+	} else {
+		innerNode->relink(oldNode, nullptr);
+	}
+
+	endNode = innerNode;
+
+	storage.deallocate(oldNode);
+	LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+
+	size -= 1;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push_front(const T& newValue) {
+	emplace_front(newValue);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push_front(T&& newValue) {
+	emplace_front(std::move(newValue));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push_back(const T& newValue) {
+	emplace_back(newValue);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::push_back(T&& newValue) {
+	emplace_back(std::move(newValue));
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename... Args>
+inline T& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::emplace_front(Args&&... args) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* valueNode = storage.template allocate<DataNode<T>>(std::in_place, std::forward<Args>(args)...);
+	LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+	linkAtEnd(valueNode, listHead, listTail);
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+
+	return valueNode->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+template <typename... Args>
+inline T& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::emplace_back(Args&&... args) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* valueNode = storage.template allocate<DataNode<T>>(std::in_place, std::forward<Args>(args)...);
+	LINKEDLIST_STATS(stats::recordAllocation(listStats, sizeof(DataNode<T>)));
+
+	linkAtEnd(valueNode, listTail, listHead);
+	LINKEDLIST_STATS(stats::recordAppend(listStats, 0));
+
+	return valueNode->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::pop_front() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(listHead);
+	unlinkAtEnd(listHead, listTail);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::pop_back() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	CheckPolicy::checkNode(listTail);
+	unlinkAtEnd(listTail, listHead);
+}
+
+//Removes the node at position and returns an iterator to the one after it.
+//Works on reverse iterators too, since they only differ in where they started.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::erase(Iterator position) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* prevNode = position.getPrevNode();
+	DataNode<T>* node = position.getNode();
+
+	CheckPolicy::checkNode(node);
+
+	DataNode<T>* nextNode = node->getOtherNode(prevNode);
+
+	if (prevNode != nullptr) {
+		prevNode->relink(node, nextNode);
+	}
+
+	if (nextNode != nullptr) {
+		nextNode->relink(node, prevNode);
+	}
+
+	if (listHead == node) {
+		listHead = prevNode == nullptr ? nextNode : prevNode;
+	}
+
+	if (listTail == node) {
+		listTail = prevNode == nullptr ? nextNode : prevNode;
+	}
+
+	storage.deallocate(node);
+	LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+
+	size -= 1;
+
+	return Iterator(prevNode, nextNode);
+}
+
+//O(1): the links read the same in both directions
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::reverse() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+
+	std::swap(listHead, listTail);
+}
+
+//Appends copies of the values of source, walking it with the previous node as the key
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::appendNodesOf(const List& source) {
+	DataNode<T>* prevNode = nullptr;
+
+	for (DataNode<T>* sourceNode = source.listHead; sourceNode != nullptr; ) {
+		DataNode<T>* nextNode = sourceNode->getOtherNode(prevNode);
+
+		emplace_back(sourceNode->getValue());
+
+		prevNode = sourceNode;
+		sourceNode = nextNode;
+	}
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+void linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::clear() {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	DataNode<T>* prevNode = nullptr;
+	DataNode<T>* currentNode = listHead;
+
+	while (currentNode != nullptr) {
+		DataNode<T>* nextNode = currentNode->getOtherNode(prevNode);
+
+		prevNode = currentNode;
+		storage.deallocate(currentNode);
+		LINKEDLIST_STATS(stats::recordFree(listStats, sizeof(DataNode<T>)));
+
+		currentNode = nextNode;
+	}
+
+	size = 0;
+	listHead = nullptr;
+	listTail = nullptr;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::front() {
+	CheckPolicy::checkNode(listHead);
+
+	return listHead->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline T& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::back() {
+	CheckPolicy::checkNode(listTail);
+
+	return listTail->getValue();
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline int linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getSize() {
+	return size;
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::memoryUsage() {
+	memory::MemoryUsage usage = memory::nodeUsage(size, sizeof(DataNode<T>), sizeof(std::uintptr_t), sizeof(T), sizeof(List));
+
+	usage.allocatorSlackBytes = storage.slackBytes(size, sizeof(DataNode<T>));
+	memory::finalizeUsage(usage);
+
+	return usage;
+}
+
+//Forward iteration from the head. end() keeps the tail as its previous
+//node so that --end() lands on the last element.
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::begin() {
+	return Iterator(nullptr, listHead);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::end() {
+	return Iterator(listTail, nullptr);
+}
+
+//Backward iteration is the same walk started from the tail
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::rbegin() {
+	return Iterator(nullptr, listTail);
+}
+
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+inline typename linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::Iterator linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::rend() {
+	return Iterator(listHead, nullptr);
+}
+
+#ifdef LINKEDLIST_ENABLE_MEMORY_REGISTRY
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::memory::MemoryUsage linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::reportUsage(void* list) {
+	return static_cast<List*>(list)->memoryUsage();
+}
+#endif
+
+#ifdef LINKEDLIST_ENABLE_STATS
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::stats::ListStats linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::getStats() {
+	return listStats;
+}
+#endif
+
+//-------Operators-------//
+
+//Walks from whichever end is closer to index
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::DataNode<T>& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator[](LINKEDLIST_INDEX_TYPE index) {
+	policy::Guard<ThreadPolicy> guard(threadPolicy);
+	int position = index > 0 ? (int)index : 0;
+	bool fromHead = position < size - position;
+	int hops = fromHead ? position : size - 1 - position;
+	DataNode<T>* prevNode = nullptr;
+	DataNode<T>* currentNode = hops < 0 ? nullptr : (fromHead ? listHead : listTail);
+
+	LINKEDLIST_STATS(stats::recordIndex(listStats, hops > 0 ? hops : 0));
+	LINKEDLIST_PROFILE(profiler::recordTraversal(index.location, hops > 0 ? hops : 0));
+
+	CheckPolicy::checkNode(currentNode);
+
+	for (int i = 0; i < hops; i++) {
+		DataNode<T>* nextNode = currentNode->getOtherNode(prevNode);
+
+		prevNode = currentNode;
+		currentNode = nextNode;
+		CheckPolicy::checkNode(currentNode);
+	}
+
+	return *currentNode;
+}
+
+//Copies the elements of other into this list's own storage, as in singlelink::List
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(const List& other) {
+	if (this != &other) {
+		clear();
+		appendNodesOf(other);
+	}
+
+	return *this;
+}
+
+//Swaps contents with other, which then owns the nodes this list held before
+template <typename T, typename StoragePolicy, typename ThreadPolicy, typename CheckPolicy>
+linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>& linkedlist::xorlink::List<T, StoragePolicy, ThreadPolicy, CheckPolicy>::operator=(List&& other) noexcept {
+	if (this != &other) {
+		std::swap(size, other.size);
+		std::swap(listHead, other.listHead);
+		std::swap(listTail, other.listTail);
+		std::swap(storage, other.storage);
+		LINKEDLIST_STATS(std::swap(listStats, other.listStats));
+	}
+
+	return *this;
+}
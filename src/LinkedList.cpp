@@ -7,4 +7,17 @@
 //
 // Created on 06/07/2024
 
-#include "LinkedList.h"
\ No newline at end of file
+#include "LinkedList.h"
+
+//Explicit instantiations for the element types declared extern in LinkedList.h
+template class linkedlist::singlelink::DataNode<int>;
+template class linkedlist::singlelink::DataNode<long>;
+template class linkedlist::singlelink::DataNode<float>;
+template class linkedlist::singlelink::DataNode<double>;
+template class linkedlist::singlelink::DataNode<std::string>;
+
+template class linkedlist::singlelink::List<int>;
+template class linkedlist::singlelink::List<long>;
+template class linkedlist::singlelink::List<float>;
+template class linkedlist::singlelink::List<double>;
+template class linkedlist::singlelink::List<std::string>;
\ No newline at end of file
@@ -0,0 +1,1626 @@
+// This file runs one reference model
+// case per invocation.
+//
+// Each case drives a container and a
+// plain standard library model with
+// the same seeded stream of random
+// operations, and compares the two
+// after every step. The first
+// mismatch is printed together with
+// the step it happened at.
+//
+// Usage: ModelTest <case>
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ChunkedDeque.h"
+#include "CompactList.h"
+#include "DoubleLinkedList.h"
+#include "HashMap.h"
+#include "IntrusiveList.h"
+#include "LinkedList.h"
+#include "ListCodec.h"
+#include "LruCache.h"
+#include "RingList.h"
+#include "SortedList.h"
+#include "StaticList.h"
+#include "XorLinkedList.h"
+
+//Set once any comparison against a model fails
+bool modelFailed = false;
+
+void check(bool condition, const std::string& what, int step) {
+	if (!condition && !modelFailed) {
+		std::cout << "FAIL " << what << " at step " << step << std::endl;
+	}
+
+	modelFailed = modelFailed || !condition;
+}
+
+/**********************************************************************************************************/
+//                                 LRU Cache                                                              //
+/**********************************************************************************************************/
+
+//Entry of the cache model, kept from most to least recently used
+struct LruModelEntry {
+	int key;
+	int value;
+	std::size_t bytes;
+};
+
+//A std::list in recency order with the same limits, counters and eviction order as LruCache
+class LruModel {
+
+	private:
+		std::list<LruModelEntry> entries;
+		std::size_t maxEntries;
+		std::size_t maxBytes;
+
+		std::list<LruModelEntry>::iterator locate(int key) {
+			for (std::list<LruModelEntry>::iterator it = entries.begin(); it != entries.end(); ++it) {
+				if (it->key == key) {
+					return it;
+				}
+			}
+
+			return entries.end();
+		}
+
+		void evictBack() {
+			evicted.push_back(entries.back().key);
+			bytes -= entries.back().bytes;
+			counters.evictions += 1;
+			entries.pop_back();
+		}
+
+		void evictOverflow() {
+			while (!entries.empty() && ((maxEntries > 0 && entries.size() > maxEntries) || (maxBytes > 0 && bytes > maxBytes))) {
+				evictBack();
+			}
+		}
+
+	public:
+		std::size_t bytes = 0;
+		linkedlist::CacheCounters counters;
+		std::vector<int> evicted;
+
+		LruModel(std::size_t entryCapacity, std::size_t byteCapacity) {
+			maxEntries = entryCapacity;
+			maxBytes = byteCapacity;
+		}
+
+		const LruModelEntry* get(int key) {
+			std::list<LruModelEntry>::iterator it = locate(key);
+
+			if (it == entries.end()) {
+				counters.misses += 1;
+				return nullptr;
+			}
+
+			counters.hits += 1;
+			entries.splice(entries.begin(), entries, it);
+
+			return &entries.front();
+		}
+
+		const LruModelEntry* peek(int key) {
+			std::list<LruModelEntry>::iterator it = locate(key);
+
+			return it == entries.end() ? nullptr : &*it;
+		}
+
+		void put(int key, int value, std::size_t entryBytes) {
+			std::list<LruModelEntry>::iterator it = locate(key);
+
+			if (it != entries.end()) {
+				bytes = bytes - it->bytes + entryBytes;
+				it->value = value;
+				it->bytes = entryBytes;
+				entries.splice(entries.begin(), entries, it);
+			} else {
+				if (maxEntries > 0 && entries.size() >= maxEntries) {
+					evictBack();
+				}
+
+				entries.push_front(LruModelEntry{ key, value, entryBytes });
+				bytes += entryBytes;
+				counters.insertions += 1;
+			}
+
+			evictOverflow();
+		}
+
+		bool erase(int key) {
+			std::list<LruModelEntry>::iterator it = locate(key);
+
+			if (it == entries.end()) {
+				return false;
+			}
+
+			bytes -= it->bytes;
+			entries.erase(it);
+
+			return true;
+		}
+
+		void setCapacity(std::size_t entryCapacity, std::size_t byteCapacity) {
+			maxEntries = entryCapacity;
+			maxBytes = byteCapacity;
+
+			evictOverflow();
+		}
+
+		const std::list<LruModelEntry>& getEntries() {
+			return entries;
+		}
+
+};
+
+void lruModelCase() {
+	std::mt19937 random(46);
+	linkedlist::LruCache<int, int> cache(64, 4000);
+	LruModel model(64, 4000);
+	std::vector<int> evicted;
+
+	cache.setEvictionCallback([&evicted](const int& key, int& value) {
+		evicted.push_back(key);
+		check(value == key * 7 || value >= 1000000, "eviction callback sees the evicted value", -1);
+	});
+
+	for (int step = 0; step < 60000; step++) {
+		int operation = (int)(random() % 100);
+		int key = (int)(random() % 160);
+
+		if (operation < 40) {
+			int* value = cache.get(key);
+			const LruModelEntry* expected = model.get(key);
+
+			check((value == nullptr) == (expected == nullptr), "get finds the same keys", step);
+			check(value == nullptr || *value == expected->value, "get returns the stored value", step);
+		} else if (operation < 50) {
+			int* value = cache.peek(key);
+			const LruModelEntry* expected = model.peek(key);
+
+			check((value == nullptr) == (expected == nullptr), "peek finds the same keys", step);
+		} else if (operation < 85) {
+			int value = random() % 4 == 0 ? 1000000 + step : key * 7;
+			std::size_t bytes = 8 + random() % 120;
+
+			cache.put(key, value, bytes);
+			model.put(key, value, bytes);
+		} else if (operation < 98) {
+			check(cache.erase(key) == model.erase(key), "erase reports the same keys", step);
+		} else {
+			std::size_t entryCapacity = random() % 3 == 0 ? 0 : 16 + random() % 96;
+			std::size_t byteCapacity = random() % 3 == 0 ? 0 : 1000 + random() % 6000;
+
+			cache.setCapacity(entryCapacity, byteCapacity);
+			model.setCapacity(entryCapacity, byteCapacity);
+		}
+
+		linkedlist::CacheCounters counters = cache.getCounters();
+
+		check(cache.getSize() == (int)model.getEntries().size(), "size", step);
+		check(cache.getBytes() == model.bytes, "bytes in use", step);
+		check(counters.hits == model.counters.hits && counters.misses == model.counters.misses, "hit and miss counters", step);
+		check(counters.insertions == model.counters.insertions && counters.evictions == model.counters.evictions, "insertion and eviction counters", step);
+		check(evicted == model.evicted, "eviction callback order", step);
+
+		if (step % 500 == 0) {
+			std::list<LruModelEntry>::const_iterator expected = model.getEntries().begin();
+
+			for (linkedlist::LruCache<int, int>::Entry& entry : cache) {
+				check(expected != model.getEntries().end() && entry.key == expected->key && entry.value == expected->value, "recency order", step);
+
+				if (expected != model.getEntries().end()) {
+					++expected;
+				}
+			}
+		}
+
+		if (modelFailed) {
+			return;
+		}
+	}
+
+	cache.resetCounters();
+	check(cache.getCounters().hits == 0 && cache.getCounters().evictions == 0, "resetCounters", 0);
+}
+
+/**********************************************************************************************************/
+//                                 Search Policies                                                        //
+/**********************************************************************************************************/
+
+//Reorders the model the way the search policy relinks the list after a hit at position hit.
+//Each model element is a value and the number of times find() hit it.
+typedef std::function<void(std::vector<std::pair<int, unsigned long long>>& model, std::size_t hit)> ReorderModel;
+
+template <typename SearchPolicy>
+void searchPolicyModelCase(unsigned int seed, ReorderModel reorder) {
+	typedef linkedlist::singlelink::List<int, linkedlist::policy::HeapStorage, linkedlist::policy::SingleThreaded, linkedlist::policy::ExitOnOutOfRange, SearchPolicy> SearchList;
+	std::mt19937 random(seed);
+	SearchList list;
+	std::vector<std::pair<int, unsigned long long>> model;
+
+	for (int step = 0; step < 40000; step++) {
+		int operation = (int)(random() % 100);
+		int value = (int)(random() % 48);
+
+		if (operation < 30) {
+			list.append(value);
+			model.push_back(std::make_pair(value, 0ULL));
+		} else if (operation < 33) {
+			//Replaced nodes start without hits, and a later node reusing the freed address must too
+			if (operation % 2 == 0) {
+				list.setListHead(new linkedlist::singlelink::DataNode<int>(value));
+			} else {
+				list.setListTail(new linkedlist::singlelink::DataNode<int>(value));
+			}
+
+			if (model.empty()) {
+				model.push_back(std::make_pair(value, 0ULL));
+			} else if (operation % 2 == 0) {
+				model.front() = std::make_pair(value, 0ULL);
+			} else {
+				model.back() = std::make_pair(value, 0ULL);
+			}
+		} else if (operation < 99) {
+			//Skew the lookups so that some values stay hot
+			if (random() % 2 == 0) {
+				value %= 6;
+			}
+
+			linkedlist::singlelink::DataNode<int>* node = list.find(value);
+			std::size_t hit = 0;
+
+			while (hit < model.size() && model[hit].first != value) {
+				hit += 1;
+			}
+
+			check((node == nullptr) == (hit == model.size()), "find hits the same values", step);
+			check(node == nullptr || node->getValue() == value, "find returns the matching node", step);
+
+			if (hit < model.size()) {
+				model[hit].second += 1;
+				reorder(model, hit);
+			}
+		} else {
+			list.clear();
+			model.clear();
+		}
+
+		check(list.getSize() == (int)model.size(), "size", step);
+		check(model.empty() ? list.getListTail() == nullptr : list.getListTail() != nullptr && list.getListTail()->getValue() == model.back().first, "tail", step);
+
+		std::size_t position = 0;
+
+		for (int listValue : list) {
+			check(position < model.size() && listValue == model[position].first, "order after find", step);
+			position += 1;
+		}
+
+		check(position == model.size(), "walk length", step);
+
+		if (modelFailed) {
+			return;
+		}
+	}
+}
+
+void transposeModelCase() {
+	searchPolicyModelCase<linkedlist::policy::Transpose>(471, [](std::vector<std::pair<int, unsigned long long>>& model, std::size_t hit) {
+		if (hit > 0) {
+			std::swap(model[hit], model[hit - 1]);
+		}
+	});
+}
+
+//A hit moves in front of the first element with fewer hits, ties keep their order
+void frequencyCountModelCase() {
+	searchPolicyModelCase<linkedlist::policy::FrequencyCount>(472, [](std::vector<std::pair<int, unsigned long long>>& model, std::size_t hit) {
+		std::size_t target = 0;
+
+		while (target < hit && model[target].second >= model[hit].second) {
+			target += 1;
+		}
+
+		std::pair<int, unsigned long long> element = model[hit];
+
+		model.erase(model.begin() + hit);
+		model.insert(model.begin() + target, element);
+	});
+}
+
+void moveToFrontModelCase() {
+	searchPolicyModelCase<linkedlist::policy::MoveToFront>(473, [](std::vector<std::pair<int, unsigned long long>>& model, std::size_t hit) {
+		std::pair<int, unsigned long long> element = model[hit];
+
+		model.erase(model.begin() + hit);
+		model.insert(model.begin(), element);
+	});
+}
+
+/**********************************************************************************************************/
+//                                 Node Adoption                                                          //
+/**********************************************************************************************************/
+
+typedef linkedlist::singlelink::DataNode<int> IntNode;
+
+template <typename ListType>
+concept AdoptsNodes = std::is_constructible<ListType, IntNode*>::value && requires(ListType& list, IntNode* node) {
+	list.addElement(node);
+	list.setListHead(node);
+	list.setListTail(node);
+};
+
+//Pooled lists free nodes onto their pool, so they must not offer to adopt the caller's nodes
+static_assert(AdoptsNodes<linkedlist::singlelink::List<int>>);
+static_assert(!AdoptsNodes<linkedlist::singlelink::List<int, linkedlist::policy::PooledStorage<>>>);
+
+//Hands nodes made with new to a heap list through the adopting constructors, addElement and
+//setListHead/setListTail, and compares with a std::deque. ASan builds catch leaks and double frees.
+void adoptionModelCase() {
+	std::mt19937 random(40);
+	linkedlist::singlelink::List<int> list;
+	std::deque<int> model;
+
+	for (int step = 0; step < 20000; step++) {
+		int operation = (int)(random() % 100);
+		int value = (int)(random() % 1000);
+
+		if (operation < 30) {
+			list.addElement(new IntNode(value));
+			model.push_back(value);
+		} else if (operation < 45) {
+			list.setListHead(new IntNode(value));
+
+			if (model.empty()) {
+				model.push_back(value);
+			} else {
+				model.front() = value;
+			}
+		} else if (operation < 60) {
+			list.setListTail(new IntNode(value));
+
+			if (model.empty()) {
+				model.push_back(value);
+			} else {
+				model.back() = value;
+			}
+		} else if (operation < 90) {
+			list.append(value);
+			model.push_back(value);
+		} else if (operation < 99) {
+			//Adopt part of a fresh chain, the caller keeps and frees the nodes after the cut
+			int length = (int)(random() % 8);
+			int kept = length == 0 ? 0 : 1 + (int)(random() % length);
+			std::vector<IntNode*> chain;
+
+			for (int i = 0; i < length; i++) {
+				chain.push_back(new IntNode(value + i));
+
+				if (i > 0) {
+					chain[i - 1]->setNextNode(chain[i]);
+				}
+			}
+
+			model.clear();
+
+			for (int i = 0; i < kept; i++) {
+				model.push_back(value + i);
+			}
+
+			if (kept == length && random() % 2 == 0) {
+				list = linkedlist::singlelink::List<int>(length == 0 ? nullptr : chain[0]);
+			} else {
+				list = linkedlist::singlelink::List<int>(kept == 0 ? nullptr : chain[0], kept == 0 ? nullptr : chain[kept - 1]);
+
+				for (int i = kept; i < length; i++) {
+					delete chain[i];
+				}
+			}
+		} else {
+			list.clear();
+			model.clear();
+		}
+
+		check(list.getSize() == (int)model.size(), "size", step);
+		check(model.empty() ? list.getListHead() == nullptr && list.getListTail() == nullptr : list.getListTail()->getValue() == model.back() && list.getListTail()->getNextNode() == nullptr, "head and tail", step);
+
+		std::deque<int>::iterator expected = model.begin();
+
+		for (int listValue : list) {
+			check(expected != model.end() && listValue == *expected, "walk order", step);
+
+			if (expected != model.end()) {
+				++expected;
+			}
+		}
+
+		check(expected == model.end(), "walk length", step);
+
+		if (modelFailed) {
+			return;
+		}
+	}
+}
+
+/**********************************************************************************************************/
+//                                 Intrusive List                                                         //
+/**********************************************************************************************************/
+
+//The virtual destructor makes the element non-standard-layout, and the second hook sits at
+//another offset, so both lists below have to find their elements from measured hook offsets
+struct IntrusiveItem {
+	int id = 0;
+	linkedlist::intrusive::ListHook listHook;
+	linkedlist::intrusive::ListHook evenHook;
+
+	virtual ~IntrusiveItem() {}
+};
+
+typedef linkedlist::intrusive::List<IntrusiveItem> IntrusiveItemList;
+typedef linkedlist::intrusive::List<IntrusiveItem, &IntrusiveItem::evenHook> EvenItemList;
+
+//Compares both walk directions, front/back, the head/tail accessors and operator[] with the model
+void checkIntrusiveWalk(IntrusiveItemList& list, const std::vector<int>& model, int step) {
+	std::size_t position = 0;
+
+	for (IntrusiveItem& item : list) {
+		check(position < model.size() && item.id == model[position], "forward walk", step);
+		position += 1;
+	}
+
+	check(position == model.size() && list.getSize() == (int)model.size(), "walk length", step);
+
+	std::vector<int>::const_reverse_iterator reverseExpected = model.rbegin();
+
+	for (IntrusiveItemList::Iterator it = list.end(); it != list.begin(); ) {
+		--it;
+		check(reverseExpected != model.rend() && it->id == *reverseExpected, "backward walk", step);
+
+		if (reverseExpected != model.rend()) {
+			++reverseExpected;
+		}
+	}
+
+	check(reverseExpected == model.rend(), "backward walk length", step);
+
+	if (model.empty()) {
+		check(list.getListHead() == nullptr && list.getListTail() == nullptr, "empty list has no head or tail", step);
+	} else {
+		check(list.front().id == model.front() && list.back().id == model.back(), "front and back", step);
+		check(list.getListHead()->id == model.front() && list.getListTail()->id == model.back(), "head and tail", step);
+		check(list[(int)((std::size_t)step % model.size())].id == model[(std::size_t)step % model.size()], "operator[]", step);
+	}
+}
+
+//Links and unlinks a fixed set of items with every entry point and moves the ring between
+//lists, against a vector of item ids. A second list threads the even items through their
+//other hook and must be untouched by all of it.
+void intrusiveListModelCase() {
+	std::mt19937 random(44);
+	std::vector<IntrusiveItem> items(48);
+	std::vector<bool> linked(items.size(), false);
+	std::vector<int> model;
+	IntrusiveItemList list;
+	EvenItemList evenList;
+
+	for (std::size_t i = 0; i < items.size(); i++) {
+		items[i].id = (int)i;
+
+		if (i % 2 == 0) {
+			evenList.push_back(items[i]);
+		}
+	}
+
+	for (int step = 0; step < 40000; step++) {
+		int operation = (int)(random() % 100);
+		int id = (int)(random() % items.size());
+
+		if (operation < 40) {
+			if (!linked[id]) {
+				std::size_t position = random() % (model.size() + 1);
+
+				if (operation < 10) {
+					position = 0;
+					list.push_front(items[id]);
+				} else if (operation < 20) {
+					position = model.size();
+					list.push_back(items[id]);
+				} else {
+					IntrusiveItemList::Iterator before = position == model.size() ? list.end() : list.iteratorTo(items[model[position]]);
+					IntrusiveItemList::Iterator inserted = list.insert(before, items[id]);
+
+					check(inserted->id == id, "insert returns the new element", step);
+				}
+
+				model.insert(model.begin() + position, id);
+				linked[id] = true;
+			}
+		} else if (operation < 55) {
+			if (linked[id]) {
+				std::size_t position = std::find(model.begin(), model.end(), id) - model.begin();
+				IntrusiveItemList::Iterator next = list.erase(list.iteratorTo(items[id]));
+
+				model.erase(model.begin() + position);
+				linked[id] = false;
+
+				check(position == model.size() ? next == list.end() : next->id == model[position], "erase returns the next element", step);
+			}
+		} else if (operation < 70) {
+			if (linked[id]) {
+				list.remove(items[id]);
+				model.erase(std::find(model.begin(), model.end(), id));
+				linked[id] = false;
+			}
+		} else if (operation < 85) {
+			if (!model.empty()) {
+				int poppedId = operation < 78 ? model.front() : model.back();
+
+				if (operation < 78) {
+					list.pop_front();
+					model.erase(model.begin());
+				} else {
+					list.pop_back();
+					model.pop_back();
+				}
+
+				linked[poppedId] = false;
+				check(!items[poppedId].listHook.isLinked(), "popped items are unlinked", step);
+			}
+		} else if (operation < 99) {
+			//adoptRing moves the ring onto the other list's root in both directions
+			IntrusiveItemList moved(std::move(list));
+
+			check(list.getSize() == 0 && list.begin() == list.end(), "moved-from list is empty", step);
+			checkIntrusiveWalk(moved, model, step);
+
+			list = std::move(moved);
+
+			check(moved.getSize() == 0 && moved.begin() == moved.end(), "move-assigned-from list is empty", step);
+		} else {
+			list.clear();
+			model.clear();
+			std::fill(linked.begin(), linked.end(), false);
+		}
+
+		checkIntrusiveWalk(list, model, step);
+
+		for (std::size_t i = 0; i < items.size(); i++) {
+			check(items[i].listHook.isLinked() == linked[i], "hooks are linked exactly for the model's items", step);
+		}
+
+		if (modelFailed) {
+			return;
+		}
+	}
+
+	int expectedEven = 0;
+
+	for (IntrusiveItem& item : evenList) {
+		check(item.id == expectedEven, "the second hook's list is untouched", 0);
+		expectedEven += 2;
+	}
+
+	check(expectedEven == (int)items.size(), "the second hook's list keeps every even item", 0);
+	list.clear();
+	evenList.clear();
+}
+
+//Destroys an item that a checked list still links. The hook exits with 139, so ctest
+//expects this case to fail; reaching the end means the check is missing.
+void intrusiveDestroyedLinkedModelCase() {
+	IntrusiveItemList list;
+
+	{
+		IntrusiveItem item;
+
+		list.push_back(item);
+	}
+
+	std::cout << "an item was destroyed while linked without exiting" << std::endl;
+}
+
+/**********************************************************************************************************/
+//                                 Ring List                                                              //
+/**********************************************************************************************************/
+
+//Pushes into a ring of the given capacity and pops from it against a std::deque that drops
+//its front whenever it grows past the capacity, the way a full ring overwrites its oldest value
+template <typename StoragePolicy>
+void ringListModelCase(unsigned int seed, int capacity) {
+	typedef linkedlist::singlelink::RingList<int, StoragePolicy> Ring;
+	std::mt19937 random(seed);
+	Ring ring(capacity);
+	std::deque<int> model;
+
+	for (int step = 0; step < 40000; step++) {
+		int operation = (int)(random() % 100);
+		int value = (int)(random() % 100000);
+
+		if (operation < 55) {
+			ring.push(value);
+			model.push_back(value);
+
+			if ((int)model.size() > capacity) {
+				model.pop_front();
+			}
+		} else if (operation < 80) {
+			if (!model.empty()) {
+				check(ring.popFront() == model.front(), "popFront returns the oldest value", step);
+				model.pop_front();
+			}
+		} else if (operation < 96) {
+			if (!model.empty()) {
+				std::size_t position = random() % model.size();
+
+				check(ring[(int)position].getValue() == model[position], "operator[]", step);
+			}
+		} else if (operation < 99) {
+			Ring copy(ring);
+			Ring moved(std::move(copy));
+
+			check(moved.getSize() == (int)model.size() && moved.getCapacity() == capacity, "copy and move sizes", step);
+
+			ring = moved;
+		} else {
+			ring.clear();
+			model.clear();
+		}
+
+		check(ring.getSize() == (int)model.size(), "size", step);
+		check(ring.isFull() == ((int)model.size() == capacity), "isFull", step);
+
+		if (!model.empty()) {
+			check(ring.getOldest() == model.front() && ring.getNewest() == model.back(), "oldest and newest", step);
+			check(ring.getListTail()->getNextNode() != nullptr, "the ring stays closed", step);
+		}
+
+		std::deque<int>::iterator expected = model.begin();
+
+		for (int value : ring) {
+			check(expected != model.end() && value == *expected, "walk from oldest to newest", step);
+
+			if (expected != model.end()) {
+				++expected;
+			}
+		}
+
+		check(expected == model.end(), "walk length", step);
+
+		if (modelFailed) {
+			return;
+		}
+	}
+}
+
+void ringListSingleModelCase() {
+	ringListModelCase<linkedlist::policy::HeapStorage>(45, 1);
+}
+
+void ringListSmallModelCase() {
+	ringListModelCase<linkedlist::policy::HeapStorage>(451, 5);
+}
+
+void ringListPooledModelCase() {
+	ringListModelCase<linkedlist::policy::PooledStorage<>>(452, 64);
+}
+
+/**********************************************************************************************************/
+//                                 Static List                                                            //
+/**********************************************************************************************************/
+
+typedef linkedlist::singlelink::StaticList<int, 8> StaticTable;
+
+//Built entirely at compile time, so the static_asserts below fail the build if any of
+//insert, remove, popFront or the free list stops being usable in a constant expression
+constexpr StaticTable buildStaticTable() {
+	StaticTable table;
+
+	for (int i = 0; i < 6; i++) {
+		table.append(i * 10);
+	}
+
+	table.insert(0, -5);
+	table.insert(3, 15);
+	table.remove(5);
+	table.popFront();
+	table.insert(table.getSize(), 60);
+	table[1].getValue() += 1;
+
+	return table;
+}
+
+template <std::size_t Count>
+constexpr bool staticTableHolds(const StaticTable& table, const int (&expected)[Count]) {
+	std::size_t position = 0;
+
+	for (int value : table) {
+		if (position >= Count || value != expected[position]) {
+			return false;
+		}
+
+		position += 1;
+	}
+
+	return position == Count && table.getSize() == (int)Count;
+}
+
+constexpr StaticTable staticTable = buildStaticTable();
+constexpr int staticTableValues[] = { 0, 11, 15, 20, 40, 50, 60 };
+
+static_assert(staticTableHolds(staticTable, staticTableValues), "compile-time insert, remove and popFront");
+static_assert(staticTable.getNode(staticTable.getTailIndex()).getValue() == 60, "compile-time tail");
+//-5 took slot 6 and was popped last, so 60 reuses it instead of the never used slot 7
+static_assert(staticTable.getTailIndex() == 6, "compile-time free slot reuse");
+
+/**********************************************************************************************************/
+//                                 Compact List                                                           //
+/**********************************************************************************************************/
+
+typedef linkedlist::singlelink::CompactList<int> IntCompactList;
+
+//Arena slot of the element at position, found by following the index links
+std::uint32_t compactSlotAt(const IntCompactList& list, int position) {
+	std::uint32_t slot = list.getHeadIndex();
+
+	for (int i = 0; i < position; i++) {
+		slot = list.getNode(slot).getNextIndex();
+	}
+
+	return slot;
+}
+
+//Compares the row-major walk and operator[] with the flattened model
+void checkCompactWalk(IntCompactList& list, const std::vector<int>& model, int step) {
+	std::size_t position = 0;
+
+	for (int value : list) {
+		check(position < model.size() && value == model[position], "walk order", step);
+		position += 1;
+	}
+
+	check(position == model.size() && list.getSize() == (int)model.size(), "walk length", step);
+	check(model.empty() ? list.getTailIndex() == IntCompactList::END : list.getNode(list.getTailIndex()).getValue() == model.back(), "tail", step);
+
+	if (!model.empty()) {
+		std::size_t probe = (std::size_t)step % model.size();
+
+		check(list[(int)probe].getValue() == model[probe], "operator[]", step);
+	}
+}
+
+//Inserts, removes and pops at random positions against a std::vector. Released slots form a
+//LIFO free list, so the model also predicts which arena slot every new element lands in.
+void compactListModelCase() {
+	std::mt19937 random(43);
+	IntCompactList list;
+	std::vector<int> model;
+	std::vector<std::uint32_t> freeSlots;
+	std::uint32_t freshSlot = 0;
+
+	for (int step = 0; step < 40000; step++) {
+		int operation = (int)(random() % 100);
+		int value = (int)(random() % 100000);
+
+		if (operation < 45) {
+			int position = (int)(random() % (model.size() + 1));
+			std::uint32_t expectedSlot = freeSlots.empty() ? freshSlot++ : freeSlots.back();
+
+			if (!freeSlots.empty()) {
+				freeSlots.pop_back();
+			}
+
+			if (random() % 2 == 0) {
+				position = (int)model.size();
+				list.append(value);
+			} else {
+				list.insert(position, value);
+			}
+
+			model.insert(model.begin() + position, value);
+
+			check(compactSlotAt(list, position) == expectedSlot, "new elements reuse the last released slot", step);
+		} else if (operation < 75) {
+			if (!model.empty()) {
+				int position = (int)(random() % model.size());
+
+				freeSlots.push_back(compactSlotAt(list, position));
+				list.remove(position);
+				model.erase(model.begin() + position);
+			}
+		} else if (operation < 85) {
+			if (!model.empty()) {
+				freeSlots.push_back(list.getHeadIndex());
+
+				check(list.popFront() == model.front(), "popFront returns the head", step);
+				model.erase(model.begin());
+			}
+		} else if (operation < 99) {
+			if (!model.empty()) {
+				int position = (int)(random() % model.size());
+
+				list[position] = value;
+				model[position] = value;
+			}
+		} else if (step % 20 == 0) {
+			list.clear();
+			model.clear();
+			freeSlots.clear();
+			freshSlot = 0;
+		}
+
+		checkCompactWalk(list, model, step);
+
+		if (modelFailed) {
+			return;
+		}
+	}
+}
+
+//Builds 2D lists through the row constructor and append2D, including rows skipped over and
+//appends to rows in the middle, and compares the row table and the row-major chain
+void compactListRowModelCase() {
+	std::mt19937 random(431);
+
+	for (int round = 0; round < 300; round++) {
+		int rowCount = (int)(random() % 5);
+		int colCount = (int)(random() % 5);
+		IntCompactList list(rowCount, colCount, round);
+		std::vector<std::vector<int>> rows(rowCount * colCount > 0 ? rowCount : 0, std::vector<int>(colCount, round));
+
+		for (int step = 0; step < 60; step++) {
+			int value = (int)(random() % 100000);
+
+			if (random() % 4 == 0 && !rows.empty()) {
+				list.append(value);
+				rows.back().push_back(value);
+			} else {
+				int row = (int)(random() % (rows.size() + 3));
+
+				list.append2D(value, row);
+
+				if (row >= (int)rows.size()) {
+					rows.resize(row + 1);
+				}
+
+				rows[row].push_back(value);
+			}
+
+			std::vector<int> flat;
+
+			for (std::size_t row = 0; row < rows.size(); row++) {
+				flat.insert(flat.end(), rows[row].begin(), rows[row].end());
+			}
+
+			check(list.getMultiDim(), "2D mode", round);
+			check(list.getRowCount() == (int)rows.size(), "row count", round);
+
+			for (std::size_t row = 0; row < rows.size(); row++) {
+				check(list.getRowSize((int)row) == (int)rows[row].size(), "row size", round);
+				check(rows[row].empty() == (list.getRowHead((int)row) == IntCompactList::END), "empty rows have no head", round);
+
+				for (std::size_t col = 0; col < rows[row].size(); col++) {
+					check(list((int)row, (int)col).getValue() == rows[row][col], "operator()", round);
+				}
+			}
+
+			checkCompactWalk(list, flat, round);
+
+			if (modelFailed) {
+				return;
+			}
+		}
+	}
+}
+
+/**********************************************************************************************************/
+//                                 XOR Linked List                                                        //
+/**********************************************************************************************************/
+
+typedef linkedlist::xorlink::List<int> XorList;
+
+//Compares both walk directions, front/back and a step back from end() with the model
+void checkXorWalks(XorList& list, const std::deque<int>& model, int step) {
+	std::deque<int>::const_iterator expected = model.begin();
+
+	for (int value : list) {
+		check(expected != model.end() && value == *expected, "forward walk", step);
+
+		if (expected != model.end()) {
+			++expected;
+		}
+	}
+
+	check(expected == model.end(), "forward walk length", step);
+
+	std::deque<int>::const_reverse_iterator reverseExpected = model.rbegin();
+
+	for (XorList::Iterator it = list.rbegin(); it != list.rend(); ++it) {
+		check(reverseExpected != model.rend() && *it == *reverseExpected, "reverse walk", step);
+
+		if (reverseExpected != model.rend()) {
+			++reverseExpected;
+		}
+	}
+
+	check(reverseExpected == model.rend(), "reverse walk length", step);
+
+	if (!model.empty()) {
+		check(list.front() == model.front() && list.back() == model.back(), "front and back", step);
+		check(*(--list.end()) == model.back() && *(--list.rend()) == model.front(), "step back from end", step);
+	}
+}
+
+//Pushes and pops at both ends, erases through forward and reverse iterators, reverses and
+//copies the list, comparing with a std::deque after every step
+void xorListModelCase() {
+	std::mt19937 random(42);
+	XorList list;
+	std::deque<int> model;
+
+	for (int step = 0; step < 60000; step++) {
+		int operation = (int)(random() % 100);
+		int value = (int)(random() % 100000);
+
+		if (operation < 22) {
+			list.push_back(value);
+			model.push_back(value);
+		} else if (operation < 44) {
+			list.emplace_front(value);
+			model.push_front(value);
+		} else if (operation < 52) {
+			if (!model.empty()) {
+				list.pop_front();
+				model.pop_front();
+			}
+		} else if (operation < 60) {
+			if (!model.empty()) {
+				list.pop_back();
+				model.pop_back();
+			}
+		} else if (operation < 68) {
+			//Erase walking forward, the returned iterator points at the next element
+			if (!model.empty()) {
+				std::size_t position = random() % model.size();
+				XorList::Iterator it = list.begin();
+
+				std::advance(it, position);
+				it = list.erase(it);
+				model.erase(model.begin() + position);
+
+				check(position == model.size() ? it == list.end() : *it == model[position], "erase returns the next element", step);
+			}
+		} else if (operation < 74) {
+			//Erase walking backward, the returned iterator keeps going toward the head
+			if (!model.empty()) {
+				std::size_t fromBack = random() % model.size();
+				std::size_t position = model.size() - 1 - fromBack;
+				XorList::Iterator it = list.rbegin();
+
+				std::advance(it, fromBack);
+				it = list.erase(it);
+				model.erase(model.begin() + position);
+
+				check(position == 0 ? it == list.rend() : *it == model[position - 1], "reverse erase returns the previous element", step);
+			}
+		} else if (operation < 80) {
+			list.reverse();
+			std::reverse(model.begin(), model.end());
+		} else if (operation < 94) {
+			if (!model.empty()) {
+				std::size_t position = random() % model.size();
+
+				check(list[(int)position].getValue() == model[position], "operator[]", step);
+
+				list[(int)position] = value;
+				model[position] = value;
+			}
+		} else if (operation < 98) {
+			XorList copy(list);
+			XorList moved(std::move(copy));
+
+			check(copy.getSize() == 0 && moved.getSize() == (int)model.size(), "copy and move sizes", step);
+
+			list = moved;
+		} else if (step % 50 == 0) {
+			list.clear();
+			model.clear();
+		}
+
+		check(list.getSize() == (int)model.size(), "size", step);
+
+		if (step % 50 == 0 || model.size() < 8) {
+			checkXorWalks(list, model, step);
+		}
+
+		if (modelFailed) {
+			return;
+		}
+	}
+}
+
+/**********************************************************************************************************/
+//                                 Shared Pools                                                           //
+/**********************************************************************************************************/
+
+//Copy-assigns random lists into a list built over a caller's pool and checks that the copy
+//matches and that its nodes keep coming from that pool rather than from the source's storage
+template <typename PooledList>
+void poolAssignmentModelCase(unsigned int seed) {
+	std::mt19937 random(seed);
+	linkedlist::policy::PooledStorage<> pool;
+	PooledList target(pool);
+
+	for (int step = 0; step < 200; step++) {
+		PooledList source;
+		std::vector<int> model;
+		int length = (int)(random() % 600);
+
+		for (int i = 0; i < length; i++) {
+			int value = (int)(random() % 1000);
+
+			source.emplace_back(value);
+			model.push_back(value);
+		}
+
+		std::size_t capacityBefore = pool.getCapacity();
+
+		target = source;
+		target = target;
+
+		std::size_t position = 0;
+
+		for (int value : target) {
+			check(position < model.size() && value == model[position], "copy order", step);
+			position += 1;
+		}
+
+		check(position == model.size() && target.getSize() == (int)model.size(), "copy length", step);
+		check(pool.getCapacity() >= model.size() && pool.getCapacity() >= capacityBefore, "the copy allocates from the target's pool", step);
+
+		if (modelFailed) {
+			return;
+		}
+	}
+}
+
+void singlePoolAssignmentModelCase() {
+	poolAssignmentModelCase<linkedlist::singlelink::List<int, linkedlist::policy::PooledStorage<>>>(34);
+}
+
+void doublePoolAssignmentModelCase() {
+	poolAssignmentModelCase<linkedlist::doublelink::List<int, linkedlist::policy::PooledStorage<>>>(341);
+}
+
+void xorPoolAssignmentModelCase() {
+	poolAssignmentModelCase<linkedlist::xorlink::List<int, linkedlist::policy::PooledStorage<>>>(342);
+}
+
+/**********************************************************************************************************/
+//                                 Sorted List                                                            //
+/**********************************************************************************************************/
+
+//Ordered by key only, seq tells equal keys apart
+struct SortedRecord {
+	int key;
+	int seq;
+};
+
+struct ByKey {
+	bool operator()(const SortedRecord& first, const SortedRecord& second) const {
+		return first.key < second.key;
+	}
+};
+
+//std::multiset places a new element after the elements it compares equal to, as SortedList does
+void sortedListModelCase() {
+	typedef linkedlist::singlelink::SortedList<SortedRecord, ByKey> RecordList;
+	typedef std::multiset<SortedRecord, ByKey> RecordSet;
+	std::mt19937 random(48);
+	RecordList list;
+	RecordSet model;
+	int seq = 0;
+
+	for (int step = 0; step < 40000; step++) {
+		int operation = (int)(random() % 100);
+		SortedRecord probe{ (int)(random() % 400), 0 };
+		RecordSet::iterator lower = model.lower_bound(probe);
+		RecordSet::iterator upper = model.upper_bound(probe);
+
+		if (operation < 40) {
+			SortedRecord record{ probe.key, seq++ };
+
+			list.insert(record);
+			model.insert(record);
+		} else if (operation < 60) {
+			bool erased = list.erase(probe);
+
+			check(erased == (lower != upper), "erase finds the same keys", step);
+
+			if (lower != upper) {
+				model.erase(lower);
+			}
+		} else if (operation < 68) {
+			std::vector<SortedRecord> batch;
+			int batchSize = (int)(random() % 24);
+
+			for (int i = 0; i < batchSize; i++) {
+				batch.push_back(SortedRecord{ (int)(random() % 400), seq++ });
+			}
+
+			std::stable_sort(batch.begin(), batch.end(), ByKey());
+			list.insert_range(batch.begin(), batch.end());
+			model.insert(batch.begin(), batch.end());
+		} else if (operation < 69 && model.size() < 2000) {
+			//A range over the list itself is copied before the merge
+			std::vector<SortedRecord> copies(model.begin(), model.end());
+
+			list.insert_range(list.begin(), list.end());
+
+			for (SortedRecord& record : copies) {
+				model.insert(record);
+			}
+		} else if (operation < 97) {
+			RecordList::Iterator listLower = list.lower_bound(probe);
+			RecordList::Iterator listUpper = list.upper_bound(probe);
+			linkedlist::singlelink::DataNode<SortedRecord>* found = list.find(probe);
+
+			check((listLower == list.end()) == (lower == model.end()), "lower_bound end", step);
+			check(lower == model.end() || listLower->seq == lower->seq, "lower_bound element", step);
+			check((listUpper == list.end()) == (upper == model.end()), "upper_bound end", step);
+			check(upper == model.end() || listUpper->seq == upper->seq, "upper_bound element", step);
+			check((found != nullptr) == (lower != upper), "find", step);
+			check(found == nullptr || found->getValue().seq == lower->seq, "find returns the first equal element", step);
+			check(list.contains(probe) == (lower != upper), "contains", step);
+		} else if (operation < 99) {
+			RecordList copy(list);
+			RecordList moved(std::move(copy));
+
+			check(copy.getSize() == 0 && moved.getSize() == (int)model.size(), "copy and move sizes", step);
+
+			list = moved;
+		} else {
+			list.clear();
+			model.clear();
+		}
+
+		check(list.getSize() == (int)model.size(), "size", step);
+
+		if (!model.empty()) {
+			check(list.front().seq == model.begin()->seq && list.back().seq == model.rbegin()->seq, "front and back", step);
+			check(list.getListTail()->getValue().seq == model.rbegin()->seq, "tail", step);
+		}
+
+		if (step % 200 == 0) {
+			RecordSet::iterator expected = model.begin();
+
+			for (SortedRecord& record : list) {
+				check(expected != model.end() && record.seq == expected->seq, "sorted order", step);
+
+				if (expected != model.end()) {
+					++expected;
+				}
+			}
+
+			if (!model.empty()) {
+				int middle = (int)model.size() / 2;
+
+				check(list[middle].getValue().seq == std::next(model.begin(), middle)->seq, "operator[]", step);
+			}
+		}
+
+		if (modelFailed) {
+			return;
+		}
+	}
+}
+
+/**********************************************************************************************************/
+//                                 Hash Map                                                               //
+/**********************************************************************************************************/
+
+//Maps many keys to the same hash so chains hold several entries
+struct CollidingHash {
+	std::size_t operator()(int key) const {
+		return (std::size_t)(key / 3);
+	}
+};
+
+//Grows the map through several incremental rehashes, then churns it, and compares every
+//lookup with std::unordered_map, including the thousands made while a rehash is in progress.
+template <typename Hash>
+void hashMapModelCase(unsigned int seed) {
+	std::mt19937 random(seed);
+	linkedlist::HashMap<int, int, Hash> map;
+	std::unordered_map<int, int> model;
+	int rehashingSteps = 0;
+
+	for (int step = 0; step < 120000; step++) {
+		int operation = (int)(random() % 100);
+		int keyRange = step < 60000 ? 40000 : 8000;
+		int key = (int)(random() % keyRange);
+		int insertShare = step < 60000 ? 60 : 35;
+
+		rehashingSteps += map.isRehashing() ? 1 : 0;
+
+		if (operation < insertShare) {
+			bool inserted = map.put(key, step);
+
+			check(inserted == (model.find(key) == model.end()), "put reports new keys", step);
+			model[key] = step;
+		} else if (operation < insertShare + 10) {
+			map[key] += 1;
+			model[key] += 1;
+		} else if (operation < insertShare + 25) {
+			check(map.erase(key) == (model.erase(key) == 1), "erase finds the same keys", step);
+		} else if (operation < 99 || step < 60000) {
+			std::unordered_map<int, int>::iterator expected = model.find(key);
+			int* value;
+
+			map.prefetch(key);
+			value = map.find(key);
+
+			check((value == nullptr) == (expected == model.end()), "find", step);
+			check(value == nullptr || *value == expected->second, "find returns the mapped value", step);
+			check(map.contains(key) == (expected != model.end()), "contains", step);
+		} else {
+			map.clear();
+			model.clear();
+		}
+
+		check(map.getSize() == (int)model.size(), "size", step);
+
+		if (step % 997 == 0 || (map.isRehashing() && step % 61 == 0)) {
+			std::size_t visited = 0;
+
+			map.forEach([&](const int& mapKey, int& mapValue) {
+				std::unordered_map<int, int>::iterator expected = model.find(mapKey);
+
+				check(expected != model.end() && expected->second == mapValue, "forEach visits the model entries", step);
+				visited += 1;
+			});
+
+			check(visited == model.size(), "forEach visits every entry once", step);
+		}
+
+		if (modelFailed) {
+			return;
+		}
+	}
+
+	check(rehashingSteps > 1000, "steps ran during a rehash", rehashingSteps);
+}
+
+void hashMapRehashModelCase() {
+	hashMapModelCase<std::hash<int>>(49);
+}
+
+void hashMapCollisionModelCase() {
+	hashMapModelCase<CollidingHash>(491);
+}
+
+/**********************************************************************************************************/
+//                                 Chunked Deque                                                          //
+/**********************************************************************************************************/
+
+//Counts live instances so that leaked or doubly destroyed slots show up
+struct CountedValue {
+	static int live;
+
+	int value;
+
+	CountedValue(int newValue) : value(newValue) {
+		live += 1;
+	}
+
+	CountedValue(const CountedValue& other) : value(other.value) {
+		live += 1;
+	}
+
+	~CountedValue() {
+		live -= 1;
+	}
+
+	CountedValue& operator=(const CountedValue& other) = default;
+};
+
+int CountedValue::live = 0;
+
+template <std::size_t BlockElements>
+void chunkedDequeModelCase(unsigned int seed) {
+	std::mt19937 random(seed);
+
+	{
+		linkedlist::ChunkedDeque<CountedValue, BlockElements> deque;
+		std::deque<int> model;
+
+		for (int step = 0; step < 100000; step++) {
+			int operation = (int)(random() % 100);
+
+			if (operation < 24) {
+				deque.push_back(CountedValue(step));
+				model.push_back(step);
+			} else if (operation < 48) {
+				deque.emplace_front(step);
+				model.push_front(step);
+			} else if (operation < 68) {
+				if (!model.empty()) {
+					deque.pop_front();
+					model.pop_front();
+				}
+			} else if (operation < 88) {
+				if (!model.empty()) {
+					deque.pop_back();
+					model.pop_back();
+				}
+			} else if (operation < 97) {
+				if (!model.empty()) {
+					std::size_t position = random() % model.size();
+
+					check(deque[(int)position].value == model[position], "operator[]", step);
+					check(deque.front().value == model.front() && deque.back().value == model.back(), "front and back", step);
+				}
+			} else if (operation < 98) {
+				deque.setSpareLimit(random() % 4);
+				deque.shrink_to_fit();
+
+				check(deque.getSpareBlocks() == 0, "shrink_to_fit drops the spare blocks", step);
+			} else if (operation < 99) {
+				linkedlist::ChunkedDeque<CountedValue, BlockElements> copy(deque);
+				linkedlist::ChunkedDeque<CountedValue, BlockElements> moved(std::move(copy));
+
+				check(copy.getSize() == 0 && moved.getSize() == (int)model.size(), "copy and move sizes", step);
+
+				deque = moved;
+			} else if (step % 7 == 0) {
+				deque.clear();
+				model.clear();
+			}
+
+			check(deque.getSize() == (int)model.size(), "size", step);
+			check(deque.getBlockCount() <= model.size() / BlockElements + 2, "blocks in use", step);
+			check(CountedValue::live >= (int)model.size(), "live values", step);
+
+			if (step % 250 == 0) {
+				std::deque<int>::iterator expected = model.begin();
+
+				for (CountedValue& value : deque) {
+					check(expected != model.end() && value.value == *expected, "walk order", step);
+
+					if (expected != model.end()) {
+						++expected;
+					}
+				}
+
+				check(expected == model.end(), "walk length", step);
+			}
+
+			if (modelFailed) {
+				return;
+			}
+		}
+	}
+
+	check(CountedValue::live == 0, "every value is destroyed with the deque", 0);
+}
+
+void chunkedDequeSingleModelCase() {
+	chunkedDequeModelCase<1>(50);
+}
+
+void chunkedDequeSmallModelCase() {
+	chunkedDequeModelCase<3>(501);
+}
+
+void chunkedDequeWideModelCase() {
+	chunkedDequeModelCase<64>(502);
+}
+
+/**********************************************************************************************************/
+//                                 List Codec                                                             //
+/**********************************************************************************************************/
+
+typedef linkedlist::singlelink::List<int, linkedlist::policy::PooledStorage<>> PooledIntList;
+
+//Stream header for the int lists below
+std::string codecHeader() {
+	std::string header(linkedlist::codec::MAGIC, sizeof(linkedlist::codec::MAGIC));
+
+	header += (char)linkedlist::codec::VERSION;
+	header += (char)sizeof(int);
+
+	return header;
+}
+
+std::vector<int> listValues(PooledIntList& list) {
+	std::vector<int> values;
+
+	for (int value : list) {
+		values.push_back(value);
+	}
+
+	return values;
+}
+
+//Decodes bytes into a list already holding prefix and checks that it is rejected and the list left as it was
+void checkRejected(const std::string& bytes, const std::string& what) {
+	const std::vector<int> prefix = { 7, INT_MIN, 9 };
+	linkedlist::policy::PooledStorage<> pool;
+	PooledIntList list(pool);
+	std::istringstream inStream(bytes);
+
+	for (int value : prefix) {
+		list.append(value);
+	}
+
+	check(!linkedlist::codec::decodeList(inStream, list), what + " is rejected", (int)bytes.size());
+	check(list.getSize() == (int)prefix.size() && listValues(list) == prefix, what + " leaves the list unchanged", (int)bytes.size());
+	check(list.getListTail() != nullptr && list.getListTail()->getNextNode() == nullptr, what + " leaves the tail unlinked", (int)bytes.size());
+}
+
+//Round trips random runs mixing the int extremes with large negative and positive deltas,
+//decoding into lists that allocate from a pool shared with the caller
+void codecRoundTripModelCase() {
+	std::mt19937 random(26);
+	const int extremes[] = { INT_MIN, INT_MAX, 0, -1, 1, INT_MIN + 1, INT_MAX - 1 };
+
+	for (int step = 0; step < 400; step++) {
+		linkedlist::singlelink::List<int> source;
+		std::vector<int> model;
+		int length = (int)(random() % 200);
+
+		for (int i = 0; i < length; i++) {
+			int value;
+
+			if (random() % 4 == 0) {
+				value = extremes[random() % 7];
+			} else if (random() % 2 == 0) {
+				value = (int)random();
+			} else {
+				value = (int)((unsigned int)(model.empty() ? 0 : model.back()) - (unsigned int)(random() % 300));
+			}
+
+			source.append(value);
+			model.push_back(value);
+		}
+
+		std::ostringstream outStream;
+		linkedlist::codec::encodeList(source, outStream);
+
+		linkedlist::policy::PooledStorage<> pool;
+		PooledIntList target(pool);
+		std::vector<int> expected;
+
+		if (step % 2 == 0) {
+			target.append(step);
+			expected.push_back(step);
+		}
+
+		expected.insert(expected.end(), model.begin(), model.end());
+
+		std::istringstream inStream(outStream.str());
+		bool decoded = linkedlist::codec::decodeList(inStream, target);
+
+		check(decoded, "decodeList accepts what encodeList wrote", step);
+		check(inStream.peek() == std::char_traits<char>::eof(), "decodeList reads the whole stream", step);
+		check(target.getSize() == (int)expected.size() && listValues(target) == expected, "decoded values", step);
+		check(expected.empty() ? target.getListTail() == nullptr : target.getListTail()->getValue() == expected.back(), "tail after decode", step);
+		check(pool.getCapacity() >= expected.size(), "decoded nodes come from the target's pool", step);
+
+		if (modelFailed) {
+			return;
+		}
+	}
+}
+
+//Every prefix of a valid stream, corrupt headers and varints writeVarint never produces
+void codecMalformedModelCase() {
+	linkedlist::singlelink::List<int> source;
+	std::ostringstream outStream;
+
+	for (int value : { 5, INT_MAX, INT_MIN, -40, 300 }) {
+		source.append(value);
+	}
+
+	linkedlist::codec::encodeList(source, outStream);
+
+	std::string valid = outStream.str();
+
+	for (std::size_t cut = 0; cut < valid.size(); cut++) {
+		checkRejected(valid.substr(0, cut), "truncated stream");
+	}
+
+	for (std::size_t position = 0; position < codecHeader().size(); position++) {
+		std::string corrupt = valid;
+
+		corrupt[position] = (char)(corrupt[position] + 1);
+		checkRejected(corrupt, position < sizeof(linkedlist::codec::MAGIC) ? "bad magic" : "bad version or width");
+	}
+
+	checkRejected(codecHeader() + std::string(10, '\x80') + "\x01", "overlong count varint");
+	checkRejected(codecHeader() + "\x01" + std::string(5, '\x80') + "\x01", "overlong value varint");
+	checkRejected(codecHeader() + "\x01" + std::string(4, '\xFF') + "\x1F", "value varint wider than int");
+	checkRejected(codecHeader() + "\x01\x81" + std::string(1, '\0'), "value varint with a zero final byte");
+	checkRejected(codecHeader() + "\x81" + std::string(1, '\0') + "\x02", "count varint with a zero final byte");
+	checkRejected(codecHeader() + "\x03\x02\x02", "count larger than the values present");
+}
+
+/**********************************************************************************************************/
+//                                 Driver                                                                 //
+/**********************************************************************************************************/
+
+std::map<std::string, std::function<void()>> buildCases() {
+	std::map<std::string, std::function<void()>> cases;
+
+	cases["lru-cache"] = lruModelCase;
+	cases["search-transpose"] = transposeModelCase;
+	cases["search-frequency"] = frequencyCountModelCase;
+	cases["search-mtf"] = moveToFrontModelCase;
+	cases["list-adoption"] = adoptionModelCase;
+	cases["pool-assignment-single"] = singlePoolAssignmentModelCase;
+	cases["pool-assignment-double"] = doublePoolAssignmentModelCase;
+	cases["pool-assignment-xor"] = xorPoolAssignmentModelCase;
+	cases["sorted-list"] = sortedListModelCase;
+	cases["hashmap-rehash"] = hashMapRehashModelCase;
+	cases["hashmap-collisions"] = hashMapCollisionModelCase;
+	cases["deque-block-1"] = chunkedDequeSingleModelCase;
+	cases["deque-block-3"] = chunkedDequeSmallModelCase;
+	cases["deque-block-64"] = chunkedDequeWideModelCase;
+	cases["xor-list"] = xorListModelCase;
+	cases["compact-list"] = compactListModelCase;
+	cases["compact-list-rows"] = compactListRowModelCase;
+	cases["intrusive-list"] = intrusiveListModelCase;
+	cases["intrusive-destroyed-linked"] = intrusiveDestroyedLinkedModelCase;
+	cases["ring-1"] = ringListSingleModelCase;
+	cases["ring-5"] = ringListSmallModelCase;
+	cases["ring-64-pooled"] = ringListPooledModelCase;
+	cases["codec-roundtrip"] = codecRoundTripModelCase;
+	cases["codec-malformed"] = codecMalformedModelCase;
+
+	return cases;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		std::cerr << "usage: ModelTest <case>" << std::endl;
+		return 2;
+	}
+
+	std::string name = argv[1];
+	std::map<std::string, std::function<void()>> cases = buildCases();
+
+	if (cases.find(name) == cases.end()) {
+		std::cerr << "unknown model case " << name << std::endl;
+		return 2;
+	}
+
+	cases[name]();
+
+	if (!modelFailed) {
+		std::cout << name << " matches its model" << std::endl;
+	}
+
+	return modelFailed ? 1 : 0;
+}
@@ -0,0 +1,426 @@
+// This file runs one performance
+// regression case per invocation
+// and compares it against baselines.
+//
+// Allocation counts are deterministic
+// and must not exceed the maximums in
+// the committed allocations.baseline.
+// A case without an entry there fails.
+// Throughput depends on the machine,
+// so the first run records it in the
+// build tree and later runs must stay
+// within the tolerance band. Until a
+// baseline is recorded the run has to
+// reach the floor in the committed
+// throughput.reference instead, unless
+// the reference is given as "-".
+//
+// Usage: ListPerfTest <case> <allocation baseline> <throughput baseline> <throughput reference> <tolerance>
+//
+// Set LINKEDLIST_PERF_UPDATE=1 to
+// overwrite the throughput baseline.
+//
+// Author: Giuseppe Daniel Ostuni
+//
+// Created on 19/10/2026
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ChunkedDeque.h"
+#include "CompactList.h"
+#include "DoubleLinkedList.h"
+#include "HashMap.h"
+#include "IntrusiveList.h"
+#include "LinkedList.h"
+#include "ListCodec.h"
+#include "LruCache.h"
+#include "RingList.h"
+#include "SortedList.h"
+#include "XorLinkedList.h"
+
+using namespace linkedlist::singlelink;
+
+const int REPETITIONS = 7;
+
+//Every allocation made by the process goes through here
+unsigned long long allocationCount = 0;
+
+void* operator new(std::size_t bytes) {
+	allocationCount += 1;
+
+	void* memory = std::malloc(bytes == 0 ? 1 : bytes);
+
+	if (memory == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+volatile long long perfSink = 0;
+
+//Element type for the intrusive cases
+struct HookedValue {
+	int value;
+	linkedlist::intrusive::ListHook listHook;
+};
+
+//A perf case prepares its input, then runs the measured body once per repetition
+struct PerfCase {
+	long long elements;
+	std::function<void()> setup;
+	std::function<void()> body;
+	std::function<void()> teardown;
+};
+
+std::map<std::string, PerfCase> buildCases() {
+	std::map<std::string, PerfCase> cases;
+	static List<int> list;
+	static linkedlist::doublelink::List<int> deque;
+	static linkedlist::xorlink::List<int> xorList;
+	static CompactList<int> compactList;
+	static linkedlist::intrusive::List<HookedValue> intrusiveList;
+	static RingList<int> window(1024);
+	static linkedlist::LruCache<int, int> cache(4096);
+	static List<int, linkedlist::policy::HeapStorage, linkedlist::policy::SingleThreaded, linkedlist::policy::ExitOnOutOfRange, linkedlist::policy::MoveToFront> lookupList;
+	static SortedList<int> sortedList;
+	static linkedlist::HashMap<int, int> hashMap;
+	static linkedlist::ChunkedDeque<int> chunkedDeque;
+	static std::string encoded;
+	const int linearSize = 100000;
+	const int indexSize = 2000;
+	static std::vector<HookedValue> hookedPool(linearSize);
+
+	cases["construct"] = PerfCase{ linearSize,
+		[]() {},
+		[]() { list = List<int>(linearSize, 1); },
+		[]() { list.clear(); } };
+
+	cases["append"] = PerfCase{ linearSize,
+		[]() { list.clear(); },
+		[]() { for (int i = 0; i < linearSize; i++) { list.append(i); } },
+		[]() { list.clear(); } };
+
+	cases["traverse"] = PerfCase{ linearSize,
+		[]() { list = List<int>(linearSize, 1); },
+		[]() {
+			long long sum = 0;
+
+			for (DataNode<int>* node = list.getListHead(); node != nullptr; node = node->getNextNode()) {
+				sum += node->getValue();
+			}
+
+			perfSink = sum;
+		},
+		[]() { list.clear(); } };
+
+	cases["index"] = PerfCase{ indexSize,
+		[]() { list = List<int>(indexSize, 1); },
+		[]() {
+			long long sum = 0;
+
+			for (int i = 0; i < indexSize; i++) {
+				sum += list[i].getValue();
+			}
+
+			perfSink = sum;
+		},
+		[]() { list.clear(); } };
+
+	cases["encode"] = PerfCase{ linearSize,
+		[]() { list.clear(); for (int i = 0; i < linearSize; i++) { list.append(i * 3); } },
+		[]() {
+			std::ostringstream outStream;
+			linkedlist::codec::encodeList(list, outStream);
+			perfSink = (long long)outStream.tellp();
+		},
+		[]() { list.clear(); } };
+
+	cases["decode"] = PerfCase{ linearSize,
+		[]() {
+			List<int> source;
+			std::ostringstream outStream;
+
+			for (int i = 0; i < linearSize; i++) {
+				source.append(i * 3);
+			}
+
+			linkedlist::codec::encodeList(source, outStream);
+			encoded = outStream.str();
+			list.clear();
+		},
+		[]() {
+			std::istringstream inStream(encoded);
+
+			if (!linkedlist::codec::decodeList(inStream, list)) {
+				std::cout << "FAIL decodeList rejected the stream encodeList wrote" << std::endl;
+				exit(1);
+			}
+		},
+		[]() { list.clear(); } };
+
+	cases["pop-back"] = PerfCase{ linearSize,
+		[]() { for (int i = 0; i < linearSize; i++) { deque.push_back(i); } },
+		[]() { while (deque.getSize() > 0) { deque.pop_back(); } },
+		[]() { deque.clear(); } };
+
+	cases["xor-traverse"] = PerfCase{ linearSize,
+		[]() { for (int i = 0; i < linearSize; i++) { xorList.push_back(i); } },
+		[]() {
+			long long sum = 0;
+
+			for (int value : xorList) {
+				sum += value;
+			}
+
+			perfSink = sum;
+		},
+		[]() { xorList.clear(); } };
+
+	cases["compact-traverse"] = PerfCase{ linearSize,
+		[]() { compactList = CompactList<int>(linearSize, 1); },
+		[]() {
+			long long sum = 0;
+
+			for (int value : compactList) {
+				sum += value;
+			}
+
+			perfSink = sum;
+		},
+		[]() { compactList.clear(); } };
+
+	cases["intrusive-link"] = PerfCase{ linearSize,
+		[]() {},
+		[]() { for (HookedValue& element : hookedPool) { intrusiveList.push_back(element); } },
+		[]() { intrusiveList.clear(); } };
+
+	cases["ring-push"] = PerfCase{ linearSize,
+		[]() { for (int i = 0; i < window.getCapacity(); i++) { window.push(i); } },
+		[]() { for (int i = 0; i < linearSize; i++) { window.push(i); } },
+		[]() { window.clear(); } };
+
+	cases["lru-get"] = PerfCase{ linearSize,
+		[]() { for (int i = 0; i < 4096; i++) { cache.put(i, i); } },
+		[]() {
+			long long sum = 0;
+
+			for (int i = 0; i < linearSize; i++) {
+				int* value = cache.get((i * 7) % 8192);
+				sum += value == nullptr ? 0 : *value;
+			}
+
+			perfSink = sum;
+		},
+		[]() { cache.clear(); } };
+
+	//Mostly hits on a small hot set, with every 16th lookup going to a cold key
+	cases["find-mtf"] = PerfCase{ linearSize,
+		[]() { for (int i = 0; i < 256; i++) { lookupList.append(i); } },
+		[]() {
+			long long found = 0;
+
+			for (int i = 0; i < linearSize; i++) {
+				int key = i % 16 == 0 ? (i / 16) % 256 : (i * 7) % 8;
+				found += lookupList.contains(key) ? 1 : 0;
+			}
+
+			perfSink = found;
+		},
+		[]() { lookupList.clear(); } };
+
+	cases["sorted-find"] = PerfCase{ linearSize,
+		[]() {
+			std::vector<int> sortedValues(linearSize);
+
+			for (int i = 0; i < linearSize; i++) {
+				sortedValues[i] = i * 2;
+			}
+
+			sortedList.insert_range(sortedValues.begin(), sortedValues.end());
+		},
+		[]() {
+			long long sum = 0;
+
+			for (int i = 0; i < linearSize; i++) {
+				SortedList<int>::Iterator bound = sortedList.lower_bound((i * 7919) % (2 * linearSize));
+				sum += bound == sortedList.end() ? 0 : *bound;
+			}
+
+			perfSink = sum;
+		},
+		[]() { sortedList.clear(); } };
+
+	//Half the lookups miss, the chain head of the key four lookups ahead is prefetched
+	cases["hashmap-get"] = PerfCase{ linearSize,
+		[]() { for (int i = 0; i < linearSize; i++) { hashMap.put(i * 2, i); } },
+		[]() {
+			long long sum = 0;
+
+			for (int i = 0; i < linearSize; i++) {
+				hashMap.prefetch((i + 4) * 7 % (2 * linearSize));
+
+				int* value = hashMap.find(i * 7 % (2 * linearSize));
+				sum += value == nullptr ? 0 : *value;
+			}
+
+			perfSink = sum;
+		},
+		[]() { hashMap.clear(); } };
+
+	//Steady queue traffic, blocks freed at the front are recycled at the back
+	cases["deque-cycle"] = PerfCase{ linearSize,
+		[]() { for (int i = 0; i < indexSize; i++) { chunkedDeque.push_back(i); } },
+		[]() {
+			long long sum = 0;
+
+			for (int i = 0; i < linearSize; i++) {
+				chunkedDeque.push_back(i);
+				sum += chunkedDeque.front();
+				chunkedDeque.pop_front();
+			}
+
+			perfSink = sum;
+		},
+		[]() { chunkedDeque.clear(); } };
+
+	return cases;
+}
+
+//Baseline files hold one "<case> <value>" pair per line, '#' starts a comment line
+bool readBaseline(const std::string& path, const std::string& name, double& value) {
+	std::ifstream inFile(path);
+	std::string line;
+
+	while (std::getline(inFile, line)) {
+		std::istringstream lineStream(line);
+		std::string entry;
+		double entryValue;
+
+		if (line.empty() || line[0] == '#' || !(lineStream >> entry >> entryValue)) {
+			continue;
+		}
+
+		if (entry == name) {
+			value = entryValue;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 6) {
+		std::cerr << "usage: ListPerfTest <case> <allocation baseline> <throughput baseline> <throughput reference> <tolerance>" << std::endl;
+		return 2;
+	}
+
+	std::string name = argv[1];
+	std::string allocationPath = argv[2];
+	std::string throughputPath = argv[3];
+	std::string referencePath = argv[4];
+	double tolerance = std::atof(argv[5]);
+
+	std::map<std::string, PerfCase> cases = buildCases();
+
+	if (cases.find(name) == cases.end()) {
+		std::cerr << "unknown perf case " << name << std::endl;
+		return 2;
+	}
+
+	PerfCase& perfCase = cases[name];
+	double bestSeconds = 0;
+	unsigned long long allocations = 0;
+
+	for (int i = 0; i < REPETITIONS; i++) {
+		perfCase.setup();
+
+		unsigned long long allocationStart = allocationCount;
+		auto startTime = std::chrono::steady_clock::now();
+		perfCase.body();
+		auto endTime = std::chrono::steady_clock::now();
+		allocations = allocationCount - allocationStart;
+
+		perfCase.teardown();
+
+		double seconds = std::chrono::duration<double>(endTime - startTime).count();
+
+		if (i == 0 || seconds < bestSeconds) {
+			bestSeconds = seconds;
+		}
+	}
+
+	double throughput = (double)perfCase.elements / bestSeconds;
+	bool passed = true;
+
+	std::cout << name << " throughput=" << throughput << " elements/s allocations=" << allocations << std::endl;
+
+	double allocationBaseline;
+
+	if (readBaseline(allocationPath, name, allocationBaseline)) {
+		if ((double)allocations > allocationBaseline) {
+			std::cout << "FAIL allocations rose from " << allocationBaseline << " to " << allocations << std::endl;
+			passed = false;
+		}
+	} else {
+		std::cout << "FAIL no allocation baseline for " << name << " in " << allocationPath << std::endl;
+		passed = false;
+	}
+
+	double throughputBaseline;
+	const char* update = std::getenv("LINKEDLIST_PERF_UPDATE");
+
+	if (readBaseline(throughputPath, name, throughputBaseline) && (update == nullptr || std::string(update) != "1")) {
+		double threshold = throughputBaseline * (1.0 - tolerance);
+
+		std::cout << "throughput baseline=" << throughputBaseline << " threshold=" << threshold << std::endl;
+
+		if (throughput < threshold) {
+			std::cout << "FAIL throughput dropped below the tolerance band" << std::endl;
+			passed = false;
+		}
+	} else {
+		double throughputReference;
+
+		//Without a local baseline only the committed floor stands between a regression and a new baseline
+		if (referencePath == "-") {
+			std::cout << "no throughput reference for this configuration" << std::endl;
+		} else if (!readBaseline(referencePath, name, throughputReference)) {
+			std::cout << "FAIL no throughput reference for " << name << " in " << referencePath << std::endl;
+			passed = false;
+		} else {
+			std::cout << "throughput reference=" << throughputReference << std::endl;
+
+			if (throughput < throughputReference) {
+				std::cout << "FAIL throughput is below the committed reference" << std::endl;
+				passed = false;
+			}
+		}
+
+		if (passed) {
+			std::ofstream outFile(throughputPath);
+			outFile << name << ' ' << throughput << std::endl;
+
+			std::cout << "recorded throughput baseline in " << throughputPath << std::endl;
+		}
+	}
+
+	return passed ? 0 : 1;
+}